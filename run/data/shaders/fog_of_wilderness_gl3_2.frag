@@ -12,12 +12,18 @@ out vec4 finalFragColor;
 // diffuseTexture is a 2D texture sampler for diffuse texture.
 uniform sampler2D diffuseTexture;
 
+// Baked from the same seamlessNoise() below by ShaderSystem::CreateNoiseTexture(), red holds the noise and green/blue
+//   hold the x/y derivatives as (derivative / 3 + 0.5). Tiles every kNoiseTileCells cells.
+uniform sampler2D uNoiseTexture;
+uniform bool uProceduralNoise = false; // Settings::FogQuality, true evaluates the noise for every fragment instead.
+
 uniform float uTime; // Timestep from CPU side to scroll noises
 uniform bool uForceTransparency = false; // Used to override the "bottom" to be also transparent
 uniform float uFogTransparency = 0.3;
 
 uniform vec2 uFogSize;
-uniform vec2 uScreenSize;
+uniform vec2 uScreenSize; // Size of the pass being drawn, which is smaller than the world with a reduced resolution.
+uniform float uFullResolutionWidth; // Width of the world target at full resolution, the same for every pass.
 
 // Could be changed per zone
 uniform vec3 uPrimaryColor = vec3(0.7, 0.5, 0.4);
@@ -35,6 +41,9 @@ layout (std140) uniform ubFogOfWilderness //NOT A STRUCT
 // This will make gl_FragCoord 0,0 for top/left, to windowWidth,windowHeight
 layout(origin_upper_left) in vec4 gl_FragCoord;
 
+// Must match kNoiseTileCells in noise_texture.hpp
+const float kNoiseTileCells = 32.0;
+
 // Noise parameters
 // Controls seamless tiling, lower is more cells
 vec2 tileSize = vec2(32.0, 32.0); 
@@ -86,28 +95,54 @@ float seamlessNoise(vec2 st, vec2 period)
     return mix(a, b, u.x) + (c - a) * u.y * (1.0 - u.x) + (d - b) * u.x * u.y;
 }
 
+// The baked texture holds a single tile of kNoiseTileCells cells, so it is repeated a whole number of times across
+//   period, however many keeps the cells closest to one unit wide. It then repeats every period as seamlessNoise()
+//   does, with slightly stretched cells when period is not a multiple of kNoiseTileCells. Must match BakedNoiseScale().
+float sampleNoise(vec2 st, vec2 period)
+{
+    if (true == uProceduralNoise)
+    {
+        return seamlessNoise(st, period);
+    }
+
+    vec2 tilesPerPeriod = max(vec2(1.0), floor(period / kNoiseTileCells + 0.5));
+    return texture(uNoiseTexture, st * tilesPerPeriod / period).r;
+}
+
 vec2 domainWarp(vec2 p, float time) 
 {
     vec2 offset = vec2(
-        seamlessNoise(p + vec2(0.0, time * 0.1), tileSize * 5.0),
-        seamlessNoise(p + vec2(5.3, time * 0.15), tileSize * 5.0)
+        sampleNoise(p + vec2(0.0, time * 0.1), tileSize * 5.0),
+        sampleNoise(p + vec2(5.3, time * 0.15), tileSize * 5.0)
     );
     return p + offset * domainWarpStrength;
 }
 
 vec2 curl(vec2 p, float t) 
 {
-    float eps = 0.01;
-    float n1, n2, a, b;
+    float a, b;
+
+    if (true == uProceduralNoise)
+    {
+        float eps = 0.01;
+        float n1, n2;
 
-    // Use seamless noise for curl calculation
-    n1 = seamlessNoise(vec2(p.x, p.y + eps) + t, tileSize);
-    n2 = seamlessNoise(vec2(p.x, p.y - eps) + t, tileSize);
-    a = (n1 - n2) / (2.0 * eps);
+        // Use seamless noise for curl calculation
+        n1 = seamlessNoise(vec2(p.x, p.y + eps) + t, tileSize);
+        n2 = seamlessNoise(vec2(p.x, p.y - eps) + t, tileSize);
+        a = (n1 - n2) / (2.0 * eps);
 
-    n1 = seamlessNoise(vec2(p.x + eps, p.y) + t, tileSize);
-    n2 = seamlessNoise(vec2(p.x - eps, p.y) + t, tileSize);
-    b = (n1 - n2) / (2.0 * eps);
+        n1 = seamlessNoise(vec2(p.x + eps, p.y) + t, tileSize);
+        n2 = seamlessNoise(vec2(p.x - eps, p.y) + t, tileSize);
+        b = (n1 - n2) / (2.0 * eps);
+    }
+    else
+    {
+        // One fetch of the baked derivatives replaces the four noise evaluations above.
+        vec2 derivatives = (texture(uNoiseTexture, (p + t) / kNoiseTileCells).gb - 0.5) * 3.0;
+        a = derivatives.y;
+        b = derivatives.x;
+    }
 
     return vec2(a, -b);
 }
@@ -125,7 +160,10 @@ float smoothFogValue()
 {
     //vec2 fogUV = gl_FragCoord.xy / uScreenSize.xy * uFogSize;
     vec2 fogUV = gl_FragCoord.xy / uScreenSize.xy * uFogSize;
-    fogUV.x = gl_FragCoord.x / clamp(uScreenSize.x, 0, 1920) * uFogSize.x;
+    // The fog covers at most 1920 full resolution pixels across, so the clamp is applied to the full resolution width
+    //   and the fragment scaled up to it first; both passes then find the same cell for the same spot in the world.
+    float fullResolutionX = gl_FragCoord.x * uFullResolutionWidth / uScreenSize.x;
+    fogUV.x = fullResolutionX / clamp(uFullResolutionWidth, 0, 1920) * uFogSize.x;
 
     ivec2 cell = ivec2(floor(fogUV));
     vec2 f = fract(fogUV);
@@ -174,7 +212,7 @@ void main(void)
     for (int i = 0; i < octaveNumbers; i++) 
     {
         vec2 noiseUV = swirledUV * frequency + invertedDirection * vec2(uTime * uFogSpeed);
-        fog += seamlessNoise(noiseUV, tileSize * frequency) * amplitude;
+        fog += sampleNoise(noiseUV, tileSize * frequency) * amplitude;
         amplitude *= 0.5;
         frequency *= 2.0;
     }
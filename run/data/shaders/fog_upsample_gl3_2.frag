@@ -0,0 +1,108 @@
+#version 150
+
+// This came from some tutorial, mentioning some drivers required this to function
+//   properly but did not delve into why.
+precision highp float;
+
+in vec2 fragmentTextureUV;
+in vec4 fragmentColor;
+
+out vec4 finalFragColor;
+
+// diffuseTexture holds the fog of wilderness rendered at a reduced resolution, see FogOfWildernessEffect.
+uniform sampler2D diffuseTexture;
+
+uniform vec2 uFogSize;
+uniform vec2 uScreenSize; // Size of the pass being drawn, which is smaller than the world with a reduced resolution.
+uniform float uFullResolutionWidth; // Width of the world target at full resolution, the same for every pass.
+uniform float uTargetHeight; // Height of the world target, the pass is drawn into the bottom uScreenSize.y rows of it.
+
+// Higher values keep the fog edges crisper, lower values blend more like plain bilinear filtering.
+uniform float uUpsampleSharpness = 8.0;
+
+layout (std140) uniform ubFogOfWilderness //NOT A STRUCT
+{
+	vec4 fog[512];
+};
+
+// This will make gl_FragCoord 0,0 for top/left, to windowWidth,windowHeight
+layout(origin_upper_left) in vec4 gl_FragCoord;
+
+// getFog() and smoothFogValue() must match fog_of_wilderness_gl3_2.frag, the full resolution mask is the guide that
+//   keeps the upsampled fog from bleeding across the edges of the revealed cells.
+float getFog(uint cx, uint cy)
+{
+    if (cx >= uFogSize.x) { return 1.0; }
+
+    uint index = cx + cy * uint(uFogSize.x);
+    return fog[index / uint(4)][index % uint(4)];
+}
+
+float smoothFogValue()
+{
+    // The reduced viewport sits at the bottom of the world target, which is the far end of gl_FragCoord.y with the
+    //   origin at the top, so the rows above it are skipped to start the pass at 0.
+    vec2 fragmentPosition = vec2(gl_FragCoord.x, gl_FragCoord.y - (uTargetHeight - uScreenSize.y));
+
+    vec2 fogUV = fragmentPosition / uScreenSize.xy * uFogSize;
+    // The fog covers at most 1920 full resolution pixels across, so the clamp is applied to the full resolution width
+    //   and the fragment scaled up to it first; both passes then find the same cell for the same spot in the world.
+    float fullResolutionX = fragmentPosition.x * uFullResolutionWidth / uScreenSize.x;
+    fogUV.x = fullResolutionX / clamp(uFullResolutionWidth, 0, 1920) * uFogSize.x;
+
+    ivec2 cell = ivec2(floor(fogUV));
+    vec2 f = fract(fogUV);
+
+    uint cx0 = uint(cell.x); //unclamped
+    uint cy0 = min(uint(cell.y), uint(uFogSize.y) - uint(1));
+    uint cx1 = uint(cell.x + 1); //unclamped
+    uint cy1 = min(uint(cell.y + 1), uint(uFogSize.y) - uint(1));
+
+    float a = getFog(cx0, cy0);
+    float b = getFog(cx1, cy0);
+    float c = getFog(cx0, cy1);
+    float d = getFog(cx1, cy1);
+
+    float fogValue = mix(mix(a, b, f.x), mix(c, d, f.x), f.y);
+    return smoothstep(0.0, 1.0, fogValue);
+}
+
+void main(void)
+{
+    vec2 lowSize = vec2(textureSize(diffuseTexture, 0));
+    vec2 lowPosition = fragmentTextureUV * lowSize - 0.5;
+    ivec2 baseTexel = ivec2(floor(lowPosition));
+    vec2 f = fract(lowPosition);
+
+    float guide = smoothFogValue();
+
+    vec4 bilateralSum = vec4(0.0);
+    vec4 bilinearSum = vec4(0.0);
+    float weightSum = 0.0;
+
+    // Joint bilateral upsample; each of the four nearest low resolution texels is weighted by its bilinear weight
+    //   and by how closely its fog alpha agrees with the full resolution mask at this fragment.
+    for (int y = 0; y < 2; ++y)
+    {
+        for (int x = 0; x < 2; ++x)
+        {
+            ivec2 texel = clamp(baseTexel + ivec2(x, y), ivec2(0), ivec2(lowSize) - 1);
+            vec4 lowSample = texelFetch(diffuseTexture, texel, 0);
+
+            float bilinearWeight = ((0 == x) ? 1.0 - f.x : f.x) * ((0 == y) ? 1.0 - f.y : f.y);
+            float edgeWeight = exp(-abs(lowSample.a - guide) * uUpsampleSharpness);
+
+            bilinearSum += lowSample * bilinearWeight;
+            bilateralSum += lowSample * bilinearWeight * edgeWeight;
+            weightSum += bilinearWeight * edgeWeight;
+        }
+    }
+
+    // Where no sample agrees with the guide (the hard top edge) fall back to plain bilinear.
+    finalFragColor = (weightSum > 0.0001) ? bilateralSum / weightSum : bilinearSum;
+
+	if (finalFragColor.a < 0.01)
+	{
+		discard;
+	}
+}
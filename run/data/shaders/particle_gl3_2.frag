@@ -0,0 +1,22 @@
+#version 150
+
+// This came from some tutorial, mentioning some drivers required this to function
+//   properly but did not delve into why.
+precision highp float;
+
+in vec4 fragmentColor;
+
+out vec4 finalFragColor;
+
+void main(void)
+{
+	// A soft round dot, gl_PointCoord goes from 0 to 1 across the point.
+	vec2 fromCenter = gl_PointCoord * 2.0 - 1.0;
+	float falloff = 1.0 - dot(fromCenter, fromCenter);
+	if (falloff <= 0.0)
+	{
+		discard;
+	}
+
+	finalFragColor = fragmentColor * smoothstep(0.0, 0.6, falloff);
+}
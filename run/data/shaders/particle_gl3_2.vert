@@ -0,0 +1,24 @@
+#version 150
+
+// Each particle is a single point, streamed from the arrays of a ParticlePool; see ParticleSystem.
+in float particleX;
+in float particleY;
+in float particleSize;
+in vec4 particleColor;
+
+out vec4 fragmentColor;
+
+// xy scales world pixels into clip space and zw offsets them, y points down like the rest of the world.
+uniform vec4 uWorldToClip;
+
+// World pixels to render target pixels, below one while dynamic resolution has the world scaled down.
+uniform float uPointScale;
+
+void main(void)
+{
+	gl_Position = vec4(vec2(particleX, particleY) * uWorldToClip.xy + uWorldToClip.zw, 0.0, 1.0);
+	gl_PointSize = max(1.0, particleSize * uPointScale);
+
+	fragmentColor = particleColor;
+	fragmentColor.rgb *= fragmentColor.a;
+}
@@ -0,0 +1,81 @@
+#version 150
+
+// This came from some tutorial, mentioning some drivers required this to function
+//   properly but did not delve into why.
+precision highp float;
+
+// fragmentTextureUV holds the position in pixels from the center of the shape, see SdfShape.
+in vec2 fragmentTextureUV;
+in vec4 fragmentColor;
+
+out vec4 finalFragColor;
+
+uniform vec4 uShapeSize;        // xy half size in pixels, z border width, w kind (0 rounded box, 1 arc)
+uniform vec4 uShapeCorners;     // corner radii: bottom right, top right, bottom left, top left
+uniform vec4 uShapeArc;         // x start angle, y sweep in radians, z thickness, w outer radius
+uniform vec4 uShapeBorderColor; // straight rgba
+
+const float kTwoPi = 6.2831853;
+
+float RoundedBoxDistance(vec2 position, vec2 halfSize, vec4 cornerRadii)
+{
+	// Pick the radius of the corner this position is nearest, y is down the screen.
+	cornerRadii.xy = (position.x > 0.0) ? cornerRadii.xy : cornerRadii.zw;
+	float radius = (position.y > 0.0) ? cornerRadii.x : cornerRadii.y;
+
+	vec2 q = abs(position) - halfSize + radius;
+	return min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - radius;
+}
+
+float SegmentDistance(vec2 position, vec2 segmentStart, vec2 segmentEnd)
+{
+	vec2 toPosition = position - segmentStart;
+	vec2 segment = segmentEnd - segmentStart;
+	float along = clamp(dot(toPosition, segment) / dot(segment, segment), 0.0, 1.0);
+	return length(toPosition - segment * along);
+}
+
+float ArcDistance(vec2 position, float startAngle, float sweep, float thickness, float outerRadius)
+{
+	float halfThickness = thickness * 0.5;
+	float ringDistance = abs(length(position) - (outerRadius - halfThickness)) - halfThickness;
+	if (sweep >= kTwoPi)
+	{
+		return ringDistance;
+	}
+
+	float angle = mod(atan(position.y, position.x) - startAngle, kTwoPi);
+	if (angle <= sweep)
+	{
+		return ringDistance;
+	}
+
+	// Past either end of the arc the distance is to the nearer of the flat end caps.
+	float innerRadius = outerRadius - thickness;
+	vec2 startEdge = vec2(cos(startAngle), sin(startAngle));
+	vec2 endEdge = vec2(cos(startAngle + sweep), sin(startAngle + sweep));
+	return min(SegmentDistance(position, startEdge * innerRadius, startEdge * outerRadius),
+		SegmentDistance(position, endEdge * innerRadius, endEdge * outerRadius));
+}
+
+// The whole shape, border included, is one quad; the coverage of each pixel comes from the distance to the edge so it
+//   stays anti-aliased at any scale without tessellating curves.
+void main(void)
+{
+	float edgeDistance = (uShapeSize.w < 0.5) ?
+		RoundedBoxDistance(fragmentTextureUV, uShapeSize.xy, uShapeCorners) :
+		ArcDistance(fragmentTextureUV, uShapeArc.x, uShapeArc.y, uShapeArc.z, uShapeArc.w);
+
+	float border = uShapeSize.z;
+	float pixelWidth = max(fwidth(edgeDistance), 0.0001);
+	float coverage = clamp(0.5 - (edgeDistance - border) / pixelWidth, 0.0, 1.0);
+
+	vec4 color = fragmentColor;
+	if (border > 0.0)
+	{
+		vec4 borderColor = vec4(uShapeBorderColor.rgb * uShapeBorderColor.a, uShapeBorderColor.a);
+		color = mix(borderColor, fragmentColor, clamp(0.5 - edgeDistance / pixelWidth, 0.0, 1.0));
+	}
+
+	finalFragColor = color * coverage;
+}
@@ -0,0 +1,24 @@
+#version 150
+
+// This came from some tutorial, mentioning some drivers required this to function
+//   properly but did not delve into why.
+precision highp float;
+
+// fragmentTextureUV is the position in the font atlas, see SdfText.
+in vec2 fragmentTextureUV;
+in vec4 fragmentColor;
+
+out vec4 finalFragColor;
+
+uniform sampler2D uFontAtlas; // single channel distance field, 0.5 is the edge of a glyph
+
+// Every size of interface text samples the same atlas; the edge is anti-aliased over however many texels one pixel
+//   covers so large titles and small labels both stay sharp.
+void main(void)
+{
+	float fieldValue = texture(uFontAtlas, fragmentTextureUV).r;
+	float halfPixel = max(fwidth(fieldValue), 0.0001) * 0.5;
+	float coverage = smoothstep(0.5 - halfPixel, 0.5 + halfPixel, fieldValue);
+
+	finalFragColor = fragmentColor * coverage;
+}
@@ -0,0 +1,63 @@
+#version 150
+
+// This came from some tutorial, mentioning some drivers required this to function
+//   properly but did not delve into why.
+precision highp float;
+
+in vec2 fragmentTextureUV;
+in vec4 fragmentColor;
+
+out vec4 finalFragColor;
+
+// diffuseTexture holds the nebula image and uStarFieldTexture the baked stars, see SpaceBackdrop.
+uniform sampler2D diffuseTexture;
+uniform sampler2D uStarFieldTexture;
+
+layout (std140) uniform ubSpaceBackdrop //NOT A STRUCT
+{
+	vec4 layerTransforms[4]; // xy offset in world pixels, z world pixels per texel, w texture (0 nebula, 1 stars)
+	vec4 layerTints[4];      // premultiplied rgba
+	vec4 backdrop;           // xy world size in pixels, z layer count
+};
+
+// Every parallax layer is sampled here and blended back to front, so the whole backdrop is a single draw that
+//   touches each pixel once rather than one full screen draw per layer.
+void main(void)
+{
+	vec2 worldPosition = fragmentTextureUV * backdrop.xy;
+	int layerCount = int(backdrop.z);
+
+	vec4 color = vec4(0.0);
+	for (int layerIndex = 0; layerIndex < 4; ++layerIndex)
+	{
+		if (layerIndex >= layerCount)
+		{
+			break;
+		}
+
+		vec4 layerTransform = layerTransforms[layerIndex];
+		bool isStarField = (layerTransform.w > 0.5);
+		vec2 layerTextureSize = vec2(isStarField ? textureSize(uStarFieldTexture, 0) : textureSize(diffuseTexture, 0));
+
+		// The gradients come from the unwrapped coordinates so the mip selection does not jump at the tile seams.
+		vec2 layerUV = (worldPosition - layerTransform.xy) / (layerTextureSize * layerTransform.z);
+		vec2 uvDeltaX = dFdx(layerUV);
+		vec2 uvDeltaY = dFdy(layerUV);
+
+		vec4 layerColor;
+		if (isStarField)
+		{
+			layerColor = textureGrad(uStarFieldTexture, fract(layerUV), uvDeltaX, uvDeltaY);
+		}
+		else
+		{
+			layerColor = textureGrad(diffuseTexture, fract(layerUV), uvDeltaX, uvDeltaY);
+			layerColor.rgb *= layerColor.a;
+		}
+
+		layerColor *= layerTints[layerIndex];
+		color = layerColor + color * (1.0 - layerColor.a);
+	}
+
+	finalFragColor = color;
+}
@@ -13,6 +13,14 @@
 #include "scenes/scene_manager.hpp"
 #include "shader_system/shaders.hpp"
 #include "shader_system/shader_manager.hpp"
+#include "shader_system/uniform_buffer.hpp"
+#include "shader_system/noise_texture.hpp"
+#include "shader_system/star_field_texture.hpp"
+#include "graphics/dynamic_resolution.hpp"
+#include "graphics/render_target_pool.hpp"
+#include "graphics/mesh_library.hpp"
+#include "graphics/particle_system.hpp"
+#include "interface/sdf_font.hpp"
 
 #include <turtle_brains/core/tb_platform_utilities.hpp>
 #include <turtle_brains/core/unit_test/tb_unit_test.hpp>
@@ -52,11 +60,23 @@ namespace Asteroids
 			ApplicationHandlerInterface::OnCreateGraphicsContext();
 			ShaderSystem::theShaderManager.CreateGraphicsContext();
 			ShaderSystem::CreateShaders();
+			ShaderSystem::CreateUniformBuffers();
+			ShaderSystem::CreateNoiseTexture();
+			ShaderSystem::CreateStarFieldTexture();
+			TheDynamicResolution().OnCreateGraphicsContext();
+			TheParticleSystem().OnCreateGraphicsContext();
+			Interface::CreateSdfFontTexture();
 		}
 
 		virtual void OnDestroyGraphicsContext(void) override
 		{
 			tb_debug_log(LogGraphics::Always() << "Asteroids handling DestroyGraphicsContext().");
+			Interface::DestroySdfFontTexture();
+			TheParticleSystem().OnDestroyGraphicsContext();
+			TheDynamicResolution().OnDestroyGraphicsContext();
+			ShaderSystem::DestroyStarFieldTexture();
+			ShaderSystem::DestroyNoiseTexture();
+			ShaderSystem::DestroyUniformBuffers();
 			ShaderSystem::DestroyShaders();
 			ShaderSystem::theShaderManager.DestroyGraphicsContext();
 			ApplicationHandlerInterface::OnDestroyGraphicsContext();
@@ -168,6 +188,8 @@ int Asteroids::Main(int argumentCount, const char* argumentValues[])
 	TheUserSettings().SaveSettings("settings.cfg");
 
 	SceneManager::DestroySceneManager();
+	TheRenderTargetPool().DestroyAll();
+	TheMeshLibrary().DestroyAll();
 	theGameApplication = nullptr;
 
 	return 0;
@@ -381,8 +403,7 @@ Asteroids::Vector2 Asteroids::RotationToForwardVector2(const Angle& orientation)
 
 float Asteroids::FixedTime(void)
 {
-	static const float kFixedTime(0.01f);
-	return kFixedTime * GameManager::TimeMultiplier();
+	return kFixedStepTime * GameManager::TimeMultiplier();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -154,6 +154,9 @@ namespace Asteroids
 
 	typedef tbCore::uint32 MillisecondTimer;
 
+	// 2026-10-19: Real seconds between each Simulate() step, TurtleBrains steps at 100hz. FixedTime() is this scaled
+	//   by the TimeMultiplier() so fast forward moves further each step rather than stepping more often.
+	static const float kFixedStepTime(0.01f);
 	float FixedTime(void);
 
 	static const float kInvalidTime(-1.0f);
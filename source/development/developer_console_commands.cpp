@@ -12,6 +12,16 @@
 
 #include "../game_manager.hpp"
 #include "../scenes/scene_manager.hpp"
+#include "../shader_system/gl_state_cache.hpp"
+#include "../shader_system/uniform_buffer.hpp"
+#include "../graphics/dynamic_resolution.hpp"
+#include "../graphics/render_target_pool.hpp"
+#include "../graphics/frame_stages.hpp"
+#include "../graphics/snapshot_renderer.hpp"
+#include "../graphics/space_backdrop.hpp"
+#include "../graphics/particle_system.hpp"
+#include "../graphics/sdf_shape.hpp"
+#include "../interface/hud_label.hpp"
 
 #include <turtle_brains/core/diagnostics/tb_console_command_system.hpp>
 
@@ -70,7 +80,7 @@ namespace Asteroids::Development
 				else
 				{
 					const StatType previousAmount = GameManager::GetActiveStats()[resourceType];
-					GameManager::GetMutableActiveStats()[resourceType] += resourceAmount;
+					GameManager::GetMutableStat(resourceType) += resourceAmount;
 					const StatType currentAmount = GameManager::GetActiveStats()[resourceType];
 
 					CommandLog("You had %d %s and now you have %d %s.",
@@ -312,6 +322,77 @@ namespace Asteroids::Development
 		}
 	};
 
+	class RenderStatsCommand : public tbCore::Diagnostics::CommandDefinition
+	{
+	public:
+		RenderStatsCommand(void) :
+			CommandDefinition("renderstats", "Display the draw, state change and timing counts from the last frame.")
+		{
+			AddSynopsis("");
+		}
+
+		virtual ~RenderStatsCommand(void)
+		{
+		}
+
+		virtual void OnRunCommand(tbCore::Diagnostics::Command& /*command*/) override
+		{
+			ShaderSystem::GLStateCache& stateCache = ShaderSystem::TheGLStateCache();
+			CommandLog("GL calls forwarded: %d, dropped: %d (since last renderstats)",
+				static_cast<int>(stateCache.GetForwardedCalls()), static_cast<int>(stateCache.GetDroppedCalls()));
+			stateCache.ResetCounters();
+
+			CommandLog("Uniform bytes uploaded: %d (since last renderstats)",
+				static_cast<int>(ShaderSystem::Implementation::UniformRingBuffer::GetBytesUploaded()));
+			ShaderSystem::Implementation::UniformRingBuffer::ResetBytesUploaded();
+
+			const DynamicResolution& dynamicResolution = TheDynamicResolution();
+			CommandLog("World resolution: %d%% (cpu %.2fms, gpu %.2fms)", static_cast<int>(dynamicResolution.GetScale() * 100.0f + 0.5f),
+				dynamicResolution.GetLastCPUTime(), dynamicResolution.GetLastGPUTime());
+
+			const RenderTargetPool& renderTargetPool = TheRenderTargetPool();
+			CommandLog("Render targets: %d (%d in use), ~%.1fMB of color", static_cast<int>(renderTargetPool.GetTargetCount()),
+				static_cast<int>(renderTargetPool.GetTargetsInUse()), static_cast<float>(renderTargetPool.GetResidentBytes()) / (1024.0f * 1024.0f));
+
+			const SnapshotRenderer::FrameStats& snapshotStats = TheSnapshotRenderer().GetLastFrameStats();
+			CommandLog("Snapshot objects: %d, mesh changes: %d, missing meshes: %d", static_cast<int>(snapshotStats.mObjectsDrawn),
+				static_cast<int>(snapshotStats.mMeshChanges), static_cast<int>(snapshotStats.mMissingMeshes));
+			CommandLog("Snapshot shader binds: %d, texture changes: %d, blend changes: %d, skipped: %d (unsorted would change %d)",
+				static_cast<int>(snapshotStats.mShaderBinds), static_cast<int>(snapshotStats.mTextureChanges),
+				static_cast<int>(snapshotStats.mBlendChanges), static_cast<int>(snapshotStats.mSkippedStateChanges),
+				static_cast<int>(snapshotStats.mUnsortedStateChanges));
+
+			const SpaceBackdrop::FrameStats& backdropStats = SpaceBackdrop::GetLastFrameStats();
+			CommandLog("Backdrop draws: %d for %d layers, %.2fM pixels shaded (%.2fM layer samples)",
+				static_cast<int>(backdropStats.mDrawCalls), static_cast<int>(backdropStats.mLayerCount),
+				static_cast<float>(backdropStats.mPixelsShaded) / 1000000.0f, static_cast<float>(backdropStats.mLayerSamples) / 1000000.0f);
+
+			const ParticleSystem& particleSystem = TheParticleSystem();
+			const ParticleSystem::FrameStats& particleStats = particleSystem.GetLastFrameStats();
+			CommandLog("Particles: %d of %d budget, emitted %d, dropped %d, %d draws, update %.3fms",
+				static_cast<int>(particleStats.mParticlesAlive), static_cast<int>(particleSystem.GetParticleBudget()),
+				static_cast<int>(particleStats.mParticlesEmitted), static_cast<int>(particleStats.mParticlesDropped),
+				static_cast<int>(particleStats.mDrawCalls), particleStats.mUpdateTime);
+
+			const SdfShape::FrameStats& shapeStats = SdfShape::GetLastFrameStats();
+			CommandLog("Interface shapes rebuilt: %d, reused: %d", static_cast<int>(shapeStats.mShapesRebuilt),
+				static_cast<int>(shapeStats.mShapesReused));
+
+			const Interface::TextCache& textCache = Interface::TheTextCache();
+			CommandLog("Text cache hits: %d, misses: %d, evictions: %d, HUD label layouts: %d", static_cast<int>(textCache.GetHits()),
+				static_cast<int>(textCache.GetMisses()), static_cast<int>(textCache.GetEvictions()),
+				static_cast<int>(Interface::HudLabel::GetLayoutCount()));
+
+			const FrameStageTimer& frameStages = TheFrameStages();
+			for (size_t stageIndex = 0; stageIndex < FrameStageTimer::kNumberOfStages; ++stageIndex)
+			{
+				const FrameStage stage = static_cast<FrameStage>(stageIndex);
+				CommandLog("Stage %s: %.2fms (smoothed %.2fms)", FrameStageTimer::GetStageName(stage),
+					frameStages.GetLastStageTime(stage), frameStages.GetSmoothedStageTime(stage));
+			}
+		}
+	};
+
 };	// namespace Asteroids
 
 
@@ -323,6 +404,7 @@ void Asteroids::Development::RegisterDeveloperCommands(void)
 	static UnlockCommand theUnlockCommand;
 //	static OpenEditorCommand theOpenEditorCommand;
 	static RunTimerCommand theRunTimerCommand;
+	static RenderStatsCommand theRenderStatsCommand;
 //	static ResetSavesEditorCommand theResetSavesEditorCommand;
 }
 
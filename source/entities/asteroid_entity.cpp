@@ -7,6 +7,8 @@
 
 #include "../entities/asteroid_entity.hpp"
 #include "../entities/bullet_entity.hpp"
+#include "../graphics/asteroid_shape.hpp"
+#include "../graphics/particle_system.hpp"
 #include "../development/development.hpp"
 
 #include "../game_manager.hpp"
@@ -37,6 +39,39 @@ namespace Asteroids::Implementation
 		return Vector2(tbMath::RandomFloat(-1.0f, 1.0f), tbMath::RandomFloat(-1.0f, 1.0f)).GetNormalized() * speed;
 	}
 
+	///
+	/// @details The variant of an asteroid mesh is | level (8) | size (16) | so every level of detail is its own mesh
+	///   and the snapshot renderer groups asteroids drawn at the same level together.
+	///
+	MeshId AsteroidMeshId(const int asteroidSize, const int detailLevel)
+	{
+		return MakeMeshId(MeshKind::Asteroid, (static_cast<tbCore::uint32>(detailLevel) << 16) |
+			(static_cast<tbCore::uint32>(asteroidSize) & 0xFFFF));
+	}
+
+	///
+	/// @details Builds every level of detail for the asteroid size, the first time it is seen, and returns how many
+	///   levels there are.
+	///
+	int CreateAsteroidMeshes(const int asteroidSize)
+	{
+		const int corners = CalculateSides(asteroidSize);
+		const int levelCount = CalculateDetailLevelCount(corners);
+		if (false == TheMeshLibrary().HasMesh(AsteroidMeshId(asteroidSize, 0)))
+		{
+			const float radius = CalculateRadius(asteroidSize);
+			const std::vector<Vector2> outline = BuildAsteroidOutline(corners, radius);
+			for (int detailLevel = 0; detailLevel < levelCount; ++detailLevel)
+			{
+				const size_t detailCorners = static_cast<size_t>(CalculateDetailCorners(corners, detailLevel));
+				TheMeshLibrary().AddMesh(AsteroidMeshId(asteroidSize, detailLevel),
+					std::make_unique<AsteroidShape>(DecimateAsteroidOutline(outline, detailCorners), radius));
+			}
+		}
+
+		return levelCount;
+	}
+
 	Angle RandomAngularVelocity(void)
 	{
 		const Angle kMaximumAngularSpeed = 45.0_degrees; //per second
@@ -48,7 +83,11 @@ namespace Asteroids::Implementation
 
 Asteroids::AsteroidEntity::AsteroidEntity(const int size, const Vector2& position, const Vector2& velocity) :
 	tbGame::Entity("AsteroidEntity"),
-	mShape(Implementation::CalculateSides(size), Implementation::CalculateRadius(size)),
+	RenderObjectWriter(),
+	mDetailLevelCount(Implementation::CreateAsteroidMeshes(size)),
+	mDetailLevel(0),
+	mPreviousTransform(RenderTransform{ position, 0.0f }),
+	mRadius(Implementation::CalculateRadius(size)),
 	mLinearVelocity(velocity),
 	mAngularVelocity(Implementation::RandomAngularVelocity()),
 	mOriginalSize(size),
@@ -57,10 +96,7 @@ Asteroids::AsteroidEntity::AsteroidEntity(const int size, const Vector2& positio
 {
 	SetPosition(position);
 
-	//mShape.SetOrigin(Anchor::Center);
-	AddGraphic(mShape);
-
-	AddBoundingCircle(mShape.GetRadius() * 0.95f);
+	AddBoundingCircle(mRadius * 0.95f);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -74,12 +110,14 @@ Asteroids::AsteroidEntity::~AsteroidEntity(void)
 void Asteroids::AsteroidEntity::OnAdd(void)
 {
 	tbGame::Entity::OnAdd();
+	StartWritingRenderObjects(GetEntityManager());
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 void Asteroids::AsteroidEntity::OnRemove(void)
 {
+	StopWritingRenderObjects();
 	tbGame::Entity::OnRemove();
 }
 
@@ -89,12 +127,13 @@ void Asteroids::AsteroidEntity::OnSimulate(void)
 {
 	tbGame::Entity::OnSimulate();
 
+	mPreviousTransform = RenderTransform{ GetPosition(), GetRotation().AsRadians() };
 	SetPosition(GetPosition() + mLinearVelocity * FixedTime());
 	SetRotation(GetRotation() + mAngularVelocity * FixedTime());
 
 	// This is duplicated in both RocketShipEntity, AsteroidEntity and kinda BulletEntity
 	const Vector2 worldSize(WorldTargetWidth(), WorldTargetHeight());
-	const float radius = mShape.GetRadius();
+	const float radius = mRadius;
 	Vector2 position = GetPosition();
 	if (position.x > worldSize.x + radius) { position.x -= worldSize.x; }
 	if (position.x < -radius) { position.x += worldSize.x; }
@@ -127,12 +166,16 @@ void Asteroids::AsteroidEntity::OnSimulate(void)
 void Asteroids::AsteroidEntity::OnUpdate(const float deltaTime)
 {
 	tbGame::Entity::OnUpdate(deltaTime);
+
+	//Chosen once a frame from the size on screen, which changes with the window through GameScale().
+	mDetailLevel = Implementation::SelectDetailLevel(mDetailLevel, mDetailLevelCount, mRadius * GameScale());
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 void Asteroids::AsteroidEntity::OnRender(void) const
 {
+	//The asteroid itself is drawn from the render snapshot, see OnWriteRenderObjects().
 	tbGame::Entity::OnRender();
 
 #if defined(rusty_development)
@@ -145,6 +188,14 @@ void Asteroids::AsteroidEntity::OnRender(void) const
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void Asteroids::AsteroidEntity::OnWriteRenderObjects(RenderSnapshot& snapshot) const
+{
+	snapshot.AddRenderObject(Implementation::AsteroidMeshId(mSize, mDetailLevel), RenderLayer::Asteroids, mPreviousTransform,
+		RenderTransform{ GetPosition(), GetRotation().AsRadians() }, ColorPalette::White);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void Asteroids::AsteroidEntity::OnCollide(const tbGame::Entity& otherEntity)
 {
 	tbGame::Entity::OnCollide(otherEntity);
@@ -174,6 +225,8 @@ void Asteroids::AsteroidEntity::BreakApart(const Vector2& impactDirection)
 {
 	tbGame::EntityManager* entityManager = GetEntityManager();
 
+	TheParticleSystem().Emit(ParticleEffects::AsteroidDebris(mSize), GetPosition(), impactDirection, mLinearVelocity);
+
 	if (mSize >= 1)
 	{
 		const float speed = mLinearVelocity.Magnitude() * 1.1f;
@@ -9,7 +9,8 @@
 #define Asteroids_AsteroidEntity_hpp
 
 #include "../asteroids.hpp"
-#include "../graphics/asteroid_shape.hpp"
+#include "../graphics/mesh_library.hpp"
+#include "../graphics/render_snapshot.hpp"
 
 namespace Asteroids
 {
@@ -18,7 +19,7 @@ namespace Asteroids
 		Vector2 RandomLinearVelocity(void);
 	};
 
-	class AsteroidEntity : public tbGame::Entity
+	class AsteroidEntity : public tbGame::Entity, public RenderObjectWriter
 	{
 	public:
 		explicit AsteroidEntity(const int size, const Vector2& position = tbGraphics::ScreenCenter(),
@@ -26,7 +27,7 @@ namespace Asteroids
 		virtual ~AsteroidEntity(void);
 
 		inline bool IsAlive(void) const { return mHitPoints > 0; }
-		inline float GetRadius(void) const { return mShape.GetRadius(); }
+		inline float GetRadius(void) const { return mRadius; }
 
 	protected:
 		virtual void OnAdd(void) override;
@@ -35,12 +36,16 @@ namespace Asteroids
 		virtual void OnUpdate(const float deltaTime) override;
 		virtual void OnRender(void) const override;
 		virtual void OnCollide(const tbGame::Entity& otherEntity) override;
+		virtual void OnWriteRenderObjects(RenderSnapshot& snapshot) const override;
 
 	private:
 		// Direction the bullet, or projectile is traveling.
 		void BreakApart(const Vector2& impactDirection);
 
-		AsteroidShape mShape;
+		int mDetailLevelCount;
+		int mDetailLevel; //of the asteroid mesh, kept between frames for the hysteresis.
+		RenderTransform mPreviousTransform; //before the last OnSimulate(), to blend from when rendering.
+		float mRadius;
 		Vector2 mLinearVelocity;
 		Angle mAngularVelocity;
 
@@ -7,20 +7,42 @@
 
 #include "../entities/bullet_entity.hpp"
 #include "../development/development.hpp"
+#include "../graphics/particle_system.hpp"
+#include "../graphics/render_sort_key.hpp"
+
+namespace Asteroids::Implementation
+{
+	const String kLaserSpriteFile = "data/laser_sprites/01.png";
+
+	//The laser sprite points to the right, the entity rotation has forward pointing up.
+	const Angle kLaserSpriteRotation = 90.0_degrees;
+
+	MeshId CreateLaserMesh(void)
+	{
+		const MeshId meshId = MakeMeshId(MeshKind::Laser);
+		if (false == TheMeshLibrary().HasMesh(meshId))
+		{
+			std::unique_ptr<tbGraphics::Sprite> laserSprite = std::make_unique<tbGraphics::Sprite>(kLaserSpriteFile);
+			laserSprite->SetOrigin(Anchor::Center);
+			TheMeshLibrary().AddMesh(meshId, std::move(laserSprite),
+				MeshState{ BlendMode::Alpha, ShaderSystem::InvalidShader(), MakeTextureKey(kLaserSpriteFile) });
+		}
+
+		return meshId;
+	}
+};
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 Asteroids::BulletEntity::BulletEntity(const Vector2& position, const Vector2& velocity) :
 	tbGame::Entity("BulletEntity"),
-	mSprite("data/laser_sprites/01.png"),
+	RenderObjectWriter(),
+	mMeshId(Implementation::CreateLaserMesh()),
+	mPreviousTransform(RenderTransform{ position, Asteroids::ForwardVector2ToRotation(velocity.GetNormalized()).AsRadians() }),
 	mLinearVelocity(velocity),
 	mRadius(11.0f),
 	mDamage(100)
 {
-	mSprite.SetOrigin(Anchor::Center);
-	mSprite.SetRotation(90.0_degrees);
-	AddGraphic(mSprite);
-
 	SetPosition(position);
 	SetRotation(Asteroids::ForwardVector2ToRotation(velocity.GetNormalized()));
 
@@ -38,12 +60,14 @@ Asteroids::BulletEntity::~BulletEntity(void)
 void Asteroids::BulletEntity::OnAdd(void)
 {
 	tbGame::Entity::OnAdd();
+	StartWritingRenderObjects(GetEntityManager());
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 void Asteroids::BulletEntity::OnRemove(void)
 {
+	StopWritingRenderObjects();
 	tbGame::Entity::OnRemove();
 }
 
@@ -53,6 +77,7 @@ void Asteroids::BulletEntity::OnSimulate(void)
 {
 	tbGame::Entity::OnSimulate();
 
+	mPreviousTransform = RenderTransform{ GetPosition(), GetRotation().AsRadians() };
 	SetPosition(GetPosition() + mLinearVelocity * FixedTime());
 
 	// This is duplicated in both RocketShipEntity, AsteroidEntity and kinda BulletEntity
@@ -81,6 +106,7 @@ void Asteroids::BulletEntity::OnUpdate(const float deltaTime)
 
 void Asteroids::BulletEntity::OnRender(void) const
 {
+	//The laser itself is drawn from the render snapshot, see OnWriteRenderObjects().
 	tbGame::Entity::OnRender();
 
 #if defined(rusty_development)
@@ -93,12 +119,24 @@ void Asteroids::BulletEntity::OnRender(void) const
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void Asteroids::BulletEntity::OnWriteRenderObjects(RenderSnapshot& snapshot) const
+{
+	const float spriteRotation = Implementation::kLaserSpriteRotation.AsRadians();
+	const RenderTransform previousTransform{ mPreviousTransform.mPosition, mPreviousTransform.mRotation + spriteRotation };
+	const RenderTransform transform{ GetPosition(), GetRotation().AsRadians() + spriteRotation };
+	snapshot.AddRenderObject(mMeshId, RenderLayer::Projectiles, previousTransform, transform, ColorPalette::White);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void Asteroids::BulletEntity::OnCollide(const tbGame::Entity& otherEntity)
 {
 	tbGame::Entity::OnCollide(otherEntity);
 
 	if (true == otherEntity.IsEntityOfType("AsteroidEntity"))
 	{
+		//Sparks fly back the way the bullet came from.
+		TheParticleSystem().Emit(ParticleEffects::BulletImpact(), GetPosition(), mLinearVelocity * -1.0f);
 		GetEntityManager()->RemoveEntity(this);
 	}
 }
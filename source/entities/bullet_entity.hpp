@@ -9,11 +9,13 @@
 #define Asteroids_BulletEntity_hpp
 
 #include "../asteroids.hpp"
+#include "../graphics/mesh_library.hpp"
+#include "../graphics/render_snapshot.hpp"
 
 namespace Asteroids
 {
 
-	class BulletEntity : public tbGame::Entity
+	class BulletEntity : public tbGame::Entity, public RenderObjectWriter
 	{
 	public:
 		explicit BulletEntity(const Vector2& position, const Vector2& velocity);
@@ -29,9 +31,11 @@ namespace Asteroids
 		virtual void OnUpdate(const float deltaTime) override;
 		virtual void OnRender(void) const override;
 		virtual void OnCollide(const tbGame::Entity& otherEntity) override;
+		virtual void OnWriteRenderObjects(RenderSnapshot& snapshot) const override;
 
 	private:
-		tbGraphics::Sprite mSprite;
+		MeshId mMeshId;
+		RenderTransform mPreviousTransform; //before the last OnSimulate(), to blend from when rendering.
 		Vector2 mLinearVelocity;
 		float mRadius;
 		int mDamage;
@@ -6,13 +6,23 @@
 ///------------------------------------------------------------------------------------------------------------------///
 
 #include "../entities/button_entity.hpp"
+#include "../graphics/partial_circle_shape.hpp"
 #include "../graphics/rounded_box_shape.hpp"
 #include "../interface.hpp"
+#include "../interface/layout_tree.hpp"
 #include "../shader_system/shaders.hpp"
+#include "../utilities/tech_tree_upgrade.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <limits>
 
 namespace
 {
 	const float kButtonPadding = 80.0f;
+
+	const size_t kNeverEvaluated = static_cast<size_t>(-1);
+	const float kNeverHoverTested = std::numeric_limits<float>::max();
 };
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -41,65 +51,76 @@ void Asteroids::ButtonFactory::SetupButton(ButtonEntity& button, const ButtonTyp
 		break; }
 	};
 
-	for (int index = 0; index < ButtonEntity::State::NumberOfStates; ++index)
+	// 2026-10-19: Each visual state used to get its own copy of the box, text and icon even though they only differ
+	//   by color. There is now one set of visuals shared by every state, the state only changes the color of the
+	//   background which is a uniform change and never rebuilds geometry.
+	tbGraphics::GraphicList& visuals = button.mVisuals;
+
+	switch (type)
 	{
-		tbGraphics::GraphicList& visuals = button.mVisuals[index];
+	case ButtonType::Primary: {
+		Asteroids::RoundedBoxShape* roundedBox = new Asteroids::RoundedBoxShape(size - Vector2(16.0f, 16.0f), size / 2.0f,
+			AsteroidsColor::PrimaryColor, kRoundedCornerRadius);
+		roundedBox->SetOrigin(Anchor::Center);
+		visuals.AddGraphic(roundedBox);
+		button.mStateGraphic = roundedBox;
+		button.mStateColors = { AsteroidsColor::PrimaryColorHalf, AsteroidsColor::PrimaryColor, AsteroidsColor::PrimaryColor };
+
+		Interface::SdfText* text = new Interface::SdfText();
+		Interface::MakeScalableText(text, labelIconSprite);
+		text->SetColor(AsteroidsColor::PrimaryTextColor);
+		text->SetOrigin(Anchor::Center);
+		text->SetScale((size.x - kButtonPadding) / text->GetWidth());
+		text->SetPosition(size / 2.0f);
+		visuals.AddGraphic(text);
 
-		switch (type)
-		{
-		case ButtonType::Primary: {
-			Asteroids::RoundedBoxShape* roundedBox = new Asteroids::RoundedBoxShape(size - Vector2(16.0f, 16.0f), size / 2.0f,
-				(ButtonEntity::State::Hovered == index) ? AsteroidsColor::PrimaryColorHalf : AsteroidsColor::PrimaryColor, kRoundedCornerRadius);
-			roundedBox->SetOrigin(Anchor::Center);
-			visuals.AddGraphic(roundedBox);
-
-			tbGraphics::Text* text = new tbGraphics::Text();
-			Interface::MakeScalableText(text, labelIconSprite);
-			text->SetColor(AsteroidsColor::PrimaryTextColor);
-			text->SetOrigin(Anchor::Center);
-			text->SetScale((size.x - kButtonPadding) / text->GetWidth());
-			text->SetPosition(size / 2.0f);
-			visuals.AddGraphic(text);
-
-			break; }
-		case ButtonType::Secondary: {
-			Asteroids::RoundedBoxShape* roundedBox = new Asteroids::RoundedBoxShape(size - Vector2(16.0f, 16.0f), size / 2.0f,
-				(ButtonEntity::State::Hovered == index) ? AsteroidsColor::SecondaryColorHalf : AsteroidsColor::SecondaryColor, kRoundedCornerRadius);
-			roundedBox->SetOrigin(Anchor::Center);
-			visuals.AddGraphic(roundedBox);
-
-			tbGraphics::Text* text = new tbGraphics::Text();
-			Interface::MakeScalableText(text, labelIconSprite);
-			text->SetOrigin(Anchor::Center);
-			text->SetColor(AsteroidsColor::SecondaryTextColor);
-			text->SetPosition(size / 2.0f);
-			text->SetScale((size.x - kButtonPadding) / text->GetWidth());
-			visuals.AddGraphic(text);
-
-			break;}
-
-		case ButtonType::SettingsButton: {
-			//tbGraphics::Sprite* settingsCog = new tbGraphics::Sprite("data/interface/icons/settings_cog.png");
-			//settingsCog->SetOrigin(Anchor::Center);
-			//settingsCog->SetPosition(size / 2.0f);
-			//settingsCog->SetColor(AsteroidsColor::SecondaryColor);
-			//visuals.AddGraphic(settingsCog);
-
-			tbGraphics::CircleShape* settingsCog = new tbGraphics::CircleShape(24.0f, AsteroidsColor::SecondaryColor);
-			settingsCog->SetOrigin(Anchor::Center);
-			settingsCog->SetPosition(size / 2.0f);
-			settingsCog->SetColor(AsteroidsColor::SecondaryColor);
-			visuals.AddGraphic(settingsCog);
-
-			break; }
-
-		case ButtonType::Iconic: {
-			break; }
-		};
-
-		visuals.RecalculateWidthAndHeight();
+		break; }
+	case ButtonType::Secondary: {
+		Asteroids::RoundedBoxShape* roundedBox = new Asteroids::RoundedBoxShape(size - Vector2(16.0f, 16.0f), size / 2.0f,
+			AsteroidsColor::SecondaryColor, kRoundedCornerRadius);
+		roundedBox->SetOrigin(Anchor::Center);
+		visuals.AddGraphic(roundedBox);
+		button.mStateGraphic = roundedBox;
+		button.mStateColors = { AsteroidsColor::SecondaryColorHalf, AsteroidsColor::SecondaryColor, AsteroidsColor::SecondaryColor };
+
+		Interface::SdfText* text = new Interface::SdfText();
+		Interface::MakeScalableText(text, labelIconSprite);
+		text->SetOrigin(Anchor::Center);
+		text->SetColor(AsteroidsColor::SecondaryTextColor);
+		text->SetPosition(size / 2.0f);
+		text->SetScale((size.x - kButtonPadding) / text->GetWidth());
+		visuals.AddGraphic(text);
+
+		break;}
+
+	case ButtonType::SettingsButton: {
+		//tbGraphics::Sprite* settingsCog = new tbGraphics::Sprite("data/interface/icons/settings_cog.png");
+		//settingsCog->SetOrigin(Anchor::Center);
+		//settingsCog->SetPosition(size / 2.0f);
+		//settingsCog->SetColor(AsteroidsColor::SecondaryColor);
+		//visuals.AddGraphic(settingsCog);
+
+		//A ring as thick as its radius is a filled circle.
+		Asteroids::PartialCircleShape* settingsCog = new Asteroids::PartialCircleShape(24.0f, AsteroidsColor::SecondaryColor,
+			Vector2::Zero(), 0.0f, tbMath::kTwoPi, 24.0f);
+		settingsCog->SetOrigin(Anchor::Center);
+		settingsCog->SetPosition(size / 2.0f);
+		visuals.AddGraphic(settingsCog);
+		button.mStateGraphic = settingsCog;
+		button.mStateColors = { AsteroidsColor::SecondaryColor, AsteroidsColor::SecondaryColor, AsteroidsColor::SecondaryColor };
+
+		break; }
+
+	case ButtonType::Iconic: {
+		break; }
+	};
+
+	if (nullptr != button.mStateGraphic)
+	{
+		button.mStateGraphic->SetColor(button.mStateColors[button.mVisualState]);
 	}
 
+	visuals.RecalculateWidthAndHeight();
 	button.RecalculateWidthAndHeight();
 }
 
@@ -112,22 +133,54 @@ Asteroids::ButtonPtr Asteroids::ButtonFactory::CreateButton(ButtonType type, con
 	return button;
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ButtonFactory::SetupAffordableEnabler(ButtonEntity& button, const UpgradeData& upgrade)
+{
+	std::vector<Stat> costStats;
+	costStats.reserve(upgrade.mStatCosts.size());
+	for (const StatValuePair& cost : upgrade.mStatCosts)
+	{
+		costStats.push_back(cost.first);
+	}
+
+	button.SetEnabler([costs = upgrade.mStatCosts]() {
+		for (const StatValuePair& cost : costs)
+		{
+			if (GameManager::GetStat(cost.first) < cost.second)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}, costStats, false);
+}
+
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 
 Asteroids::ButtonEntity::ButtonEntity(void) :
 	tbGame::Entity("ButtonEntity"),
+	mVisuals(),
+	mStateColors({ ColorPalette::White, ColorPalette::White, ColorPalette::White }),
+	mStateGraphic(nullptr),
 	mPressedAudioEvent(""),
 	mOnClick(nullptr),
 	mEnabler(nullptr),
+	mEnablerStats(),
+	mEnablerRevision(kNeverEvaluated),
+	mLayoutTree(nullptr),
+	mLastHoverTest{ Vector2(kNeverHoverTested, kNeverHoverTested), Vector2::Zero(), 0.0f, 0.0f, false },
+	mVisualState(State::Enabled),
 	mIsEnabled(true),
 	mIsHovered(false),
+	mIsEnablerPolled(false),
+	mEnablerUsesUnlockKeys(false),
 	mRunningTimer(0.0f)
 {
-	AddGraphic(mVisuals[State::Disabled]);
-	AddGraphic(mVisuals[State::Enabled]);
-	AddGraphic(mVisuals[State::Hovered]);
+	AddGraphic(mVisuals);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -145,6 +198,29 @@ bool Asteroids::ButtonEntity::IsDisabled(void) const
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void Asteroids::ButtonEntity::SetEnabler(std::function<bool()> enabler)
+{
+	mEnabler = enabler;
+	mEnablerStats.clear();
+	mEnablerRevision = kNeverEvaluated;
+	mIsEnablerPolled = true;
+	mEnablerUsesUnlockKeys = false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ButtonEntity::SetEnabler(std::function<bool()> enabler, const std::vector<Stat>& dependsOnStats,
+	const bool dependsOnUnlockKeys)
+{
+	mEnabler = enabler;
+	mEnablerStats = dependsOnStats;
+	mEnablerRevision = kNeverEvaluated;
+	mIsEnablerPolled = false;
+	mEnablerUsesUnlockKeys = dependsOnUnlockKeys;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void Asteroids::ButtonEntity::SetAvailable(const bool isAvailable)
 {
 	SetVisible(isAvailable);
@@ -152,6 +228,30 @@ void Asteroids::ButtonEntity::SetAvailable(const bool isAvailable)
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void Asteroids::ButtonEntity::UpdateEnabler(void)
+{
+	if (nullptr == mEnabler)
+	{
+		return;
+	}
+
+	if (true == mIsEnablerPolled)
+	{
+		SetEnabled(mEnabler());
+	}
+	else
+	{
+		const size_t enablerRevision = GameManager::GetDependencyRevision(mEnablerStats, mEnablerUsesUnlockKeys);
+		if (enablerRevision != mEnablerRevision)
+		{
+			mEnablerRevision = enablerRevision;
+			SetEnabled(mEnabler());
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 #if defined(rusty_development)
 void Asteroids::ButtonEntity::Development_ForceClickCallback(void)
 {
@@ -188,14 +288,26 @@ void Asteroids::ButtonEntity::OnUpdate(const float deltaTime)
 
 	mRunningTimer += deltaTime;
 
-	if (nullptr != mEnabler)
+	// 2026-10-19: Every button used to call its enabler, and test the mouse against itself, every update. An enabler
+	//   given its dependencies is only called when one of those stats or the unlock keys changed, and the hover is only
+	//   tested again once the mouse moved or the button moved, resized or was hidden. A screen full of idle buttons now
+	//   does next to nothing.
+	UpdateEnabler();
+
+	if (nullptr != mLayoutTree)
 	{
-		bool result = mEnabler();
-		SetEnabled(result);
+		mIsHovered = mLayoutTree->IsHovered(*this);
+	}
+	else
+	{
+		const Vector2 mousePositionInterface = Interface::ScreenSpaceToInterface(tbGame::Input::GetMousePosition());
+		const HoverTest hoverTest{ mousePositionInterface - GetPosition(), GetScale(), GetWidth(), GetHeight(), IsVisible() };
+		if (false == (hoverTest == mLastHoverTest))
+		{
+			mLastHoverTest = hoverTest;
+			mIsHovered = UnstableIsPointContained(mousePositionInterface);
+		}
 	}
-
-	const Vector2 mousePositionInterface = Interface::ScreenSpaceToInterface(tbGame::Input::GetMousePosition());
-	mIsHovered = UnstableIsPointContained(mousePositionInterface);
 
 	if (false == IsDisabled() && true == mIsHovered && true == tbGame::Input::IsKeyPressed(tbApplication::tbMouseLeft))
 	{
@@ -207,9 +319,15 @@ void Asteroids::ButtonEntity::OnUpdate(const float deltaTime)
 		mOnClick();
 	}
 
-	mVisuals[State::Hovered].SetVisible(true == mIsEnabled && true == mIsHovered);
-	mVisuals[State::Enabled].SetVisible(true == mIsEnabled && false == mIsHovered);
-	mVisuals[State::Disabled].SetVisible(false == mIsEnabled);
+	const State visualState = (false == mIsEnabled) ? State::Disabled : ((true == mIsHovered) ? State::Hovered : State::Enabled);
+	if (visualState != mVisualState)
+	{
+		mVisualState = visualState;
+		if (nullptr != mStateGraphic)
+		{
+			mStateGraphic->SetColor(mStateColors[mVisualState]);
+		}
+	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -218,7 +336,7 @@ void Asteroids::ButtonEntity::OnRender(void) const
 {
 	tbGame::Entity::OnRender();
 
-	if (true == mVisuals[State::Hovered].IsVisible())
+	if (State::Hovered == mVisualState)
 	{
 		for (auto* sprite : mHoverButtonSprites)
 		{
@@ -243,3 +361,69 @@ void Asteroids::ButtonEntity::OnCollide(const tbGame::Entity& otherEntity)
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class ButtonEnablerTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		ButtonEnablerTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::ButtonEnablerTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			const StatType originalExperience = GameManager::GetStat(Stat::Experience);
+			const StatType originalPlayTime = GameManager::GetStat(Stat::TotalPlayTime);
+
+			UpgradeData upgrade;
+			upgrade.mStatCosts = { { Stat::Experience, originalExperience + 100.0 } };
+
+			int evaluations = 0;
+			ButtonEntity button;
+			button.SetClickCallback([]() { });
+			ButtonFactory::SetupAffordableEnabler(button, upgrade);
+			const auto affordable = [&button]() { return false == button.IsDisabled(); };
+
+			button.UpdateEnabler();
+			ExpectedValue(affordable(), false, "Expected the upgrade to cost more experience than there is.");
+
+			button.SetEnabler([&evaluations]() { ++evaluations; return true; }, { Stat::Experience }, false);
+			button.UpdateEnabler();
+			button.UpdateEnabler();
+			ExpectedValue(evaluations, 1, "Expected the enabler to be evaluated once until something changes.");
+
+			GameManager::GetActiveStats();
+			GameManager::SetStat(Stat::Experience, originalExperience);
+			button.UpdateEnabler();
+			ExpectedValue(evaluations, 1, "Expected reading or setting the same value to not count as a change.");
+
+			GameManager::SetStat(Stat::TotalPlayTime, originalPlayTime + 1.0);
+			button.UpdateEnabler();
+			ExpectedValue(evaluations, 1, "Expected a stat the enabler does not depend on to be ignored.");
+
+			GameManager::SetStat(Stat::Experience, originalExperience + 1.0);
+			button.UpdateEnabler();
+			ExpectedValue(evaluations, 2, "Expected a change to a dependency to evaluate the enabler again.");
+
+			ButtonFactory::SetupAffordableEnabler(button, upgrade);
+			GameManager::SetStat(Stat::Experience, originalExperience + 100.0);
+			button.UpdateEnabler();
+			ExpectedValue(affordable(), true, "Expected earning the experience to enable the upgrade.");
+
+			GameManager::SetStat(Stat::Experience, originalExperience);
+			GameManager::SetStat(Stat::TotalPlayTime, originalPlayTime);
+			return true;
+		}
+	};
+
+	ButtonEnablerTest theButtonEnablerTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -9,11 +9,16 @@
 #define Asteroids_ButtonEntity_hpp
 
 #include "../asteroids.hpp"
+#include "../game_manager.hpp"
 
 #include <functional>
+#include <vector>
 
 namespace Asteroids
 {
+	namespace Interface { class LayoutTree; }
+	class UpgradeData;
+
 	enum ButtonType {
 		Primary,
 		Secondary,
@@ -29,6 +34,12 @@ namespace Asteroids
 		void SetupButton(ButtonEntity& button, const ButtonType type, const String& labelIconSprite);
 
 		ButtonPtr CreateButton(ButtonType type, const String& labelIconSprite);
+
+		///
+		/// @details Enables the button only while every cost of the upgrade can be paid, checked again only when one of
+		///   the stats it costs changes rather than every update, so a tech tree full of these idles for free.
+		///
+		void SetupAffordableEnabler(ButtonEntity& button, const UpgradeData& upgrade);
 	};
 
 
@@ -42,10 +53,27 @@ namespace Asteroids
 		bool IsDisabled(void) const;
 
 		void SetClickCallback(std::function<void()> onClick) { mOnClick = onClick; }
-		void SetEnabler(std::function<bool()> enabler) { mEnabler = enabler; }
+		///
+		/// @details An enabler without dependencies is checked every update. Given the stats, and whether the unlock keys,
+		///   that it reads it is only checked again when one of those changes, see GameManager::GetStatRevision().
+		///
+		void SetEnabler(std::function<bool()> enabler);
+		void SetEnabler(std::function<bool()> enabler, const std::vector<Stat>& dependsOnStats, const bool dependsOnUnlockKeys);
 
 		void SetAvailable(const bool isAvailable);
 
+		///
+		/// @details Calls the enabler if it is polled or one of its dependencies changed, OnUpdate() does this each
+		///   update. Can be called right after a purchase so the button does not wait for the next update.
+		///
+		void UpdateEnabler(void);
+
+		///
+		/// @details When the button is placed by a LayoutTree it asks the tree whether it is hovered, which is found once
+		///   for the whole interface, rather than testing the mouse against itself every update.
+		///
+		void SetLayoutTree(const Interface::LayoutTree* layoutTree) { mLayoutTree = layoutTree; }
+
 #if defined(rusty_development)
 		void Development_ForceClickCallback(void);
 #endif
@@ -62,14 +90,36 @@ namespace Asteroids
 		friend void ButtonFactory::SetupButton(ButtonEntity& button, const ButtonType type, const String& labelIconSprite);
 
 		enum State { Hovered, Enabled, Disabled, NumberOfStates };
-		std::array<tbGraphics::GraphicList, NumberOfStates> mVisuals;
+
+		//Anything that moves, resizes or hides the button, or moves the mouse, changes the result of the hover test.
+		struct HoverTest
+		{
+			Vector2 mMouseFromButton;
+			Vector2 mScale;
+			float mWidth;
+			float mHeight;
+			bool mIsVisible;
+
+			bool operator==(const HoverTest& other) const = default;
+		};
+
+		tbGraphics::GraphicList mVisuals; //shared by every state.
+		std::array<Color, NumberOfStates> mStateColors;
+		tbGraphics::Graphic* mStateGraphic; //owned by mVisuals, the part that is recolored by the state.
 		std::vector<tbGraphics::Sprite*> mHoverButtonSprites;
 
 		String mPressedAudioEvent;
 		std::function<void()> mOnClick;
 		std::function<bool()> mEnabler;
+		std::vector<Stat> mEnablerStats;
+		size_t mEnablerRevision;
+		const Interface::LayoutTree* mLayoutTree;
+		HoverTest mLastHoverTest; //only tested again when something in it changed.
+		State mVisualState;
 		bool mIsEnabled;
 		bool mIsHovered;
+		bool mIsEnablerPolled;
+		bool mEnablerUsesUnlockKeys;
 
 		float mRunningTimer;
 	};
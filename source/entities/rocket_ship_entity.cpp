@@ -7,13 +7,29 @@
 
 #include "../entities/rocket_ship_entity.hpp"
 #include "../entities/bullet_entity.hpp"
+#include "../graphics/rocket_ship_shape.hpp"
 
 #include "../development/development.hpp"
 
+namespace Asteroids::Implementation
+{
+	MeshId CreateRocketShipMesh(void)
+	{
+		const MeshId meshId = MakeMeshId(MeshKind::RocketShip);
+		if (false == TheMeshLibrary().HasMesh(meshId))
+		{
+			TheMeshLibrary().AddMesh(meshId, std::make_unique<RocketShipShape>(TyreBytes::ColorPalette::Pink));
+		}
+
+		return meshId;
+	}
+};
+
 //--------------------------------------------------------------------------------------------------------------------//
 
 Asteroids::RocketShipEntity::RocketShipEntity(const Vector2& position) :
 	tbGame::Entity("RocketShipEntity"),
+	RenderObjectWriter(),
 	mThrustForward(Key::tbKeyUp),
 	mThrustBackward(Key::tbKeyDown),
 	mThrustRight(Key::tbKeyRight),
@@ -21,7 +37,8 @@ Asteroids::RocketShipEntity::RocketShipEntity(const Vector2& position) :
 	mShootWeapon(Key::tbMouseLeft),
 	mActivateWeapon(Key::tbKeyQ),
 	mWeaponReloadTimer(RustyTimer::Zero()),
-	mShape(TyreBytes::ColorPalette::Pink),
+	mMeshId(Implementation::CreateRocketShipMesh()),
+	mPreviousTransform(RenderTransform{ position, 0.0f }),
 	mLinearVelocity(Vector2::Zero()),
 	mAngularVelocity(Angle::Zero())
 {
@@ -30,12 +47,9 @@ Asteroids::RocketShipEntity::RocketShipEntity(const Vector2& position) :
 	mThrustRight.AddBinding(tbApplication::tbKeyD);
 	mThrustLeft.AddBinding(tbApplication::tbKeyA);
 
-	//mShape.SetOrigin(Anchor::Center);
-	AddGraphic(mShape);
-
 	SetPosition(position);
 
-	AddBoundingCircle(mShape.GetRadius() * 0.7f);
+	AddBoundingCircle(RocketShipShape::kRadius * 0.7f);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -49,12 +63,14 @@ Asteroids::RocketShipEntity::~RocketShipEntity(void)
 void Asteroids::RocketShipEntity::OnAdd(void)
 {
 	tbGame::Entity::OnAdd();
+	StartWritingRenderObjects(GetEntityManager());
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 void Asteroids::RocketShipEntity::OnRemove(void)
 {
+	StopWritingRenderObjects();
 	tbGame::Entity::OnRemove();
 }
 
@@ -64,6 +80,8 @@ void Asteroids::RocketShipEntity::OnSimulate(void)
 {
 	tbGame::Entity::OnSimulate();
 
+	mPreviousTransform = RenderTransform{ GetPosition(), GetRotation().AsRadians() };
+
 	const float kMaximumLinearSpeed = 500.0f;
 	const Angle kMaximumAngularSpeed = 360.0_degrees; //per second
 	const float kLinearAcceleration = 500.0f; //per second^2
@@ -112,7 +130,7 @@ void Asteroids::RocketShipEntity::OnSimulate(void)
 
 		// This is duplicated in both RocketShipEntity, AsteroidEntity and kinda BulletEntity
 		const Vector2 worldSize(WorldTargetWidth(), WorldTargetHeight());
-		const float radius = mShape.GetRadius();
+		const float radius = RocketShipShape::kRadius;
 		Vector2 position = GetPosition();
 		if (position.x > worldSize.x + radius) { position.x -= worldSize.x; }
 		if (position.x < -radius) { position.x += worldSize.x; }
@@ -157,6 +175,7 @@ void Asteroids::RocketShipEntity::OnUpdate(const float deltaTime)
 
 void Asteroids::RocketShipEntity::OnRender(void) const
 {
+	//The ship itself is drawn from the render snapshot, see OnWriteRenderObjects().
 	tbGame::Entity::OnRender();
 
 #if defined(rusty_development)
@@ -169,6 +188,14 @@ void Asteroids::RocketShipEntity::OnRender(void) const
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void Asteroids::RocketShipEntity::OnWriteRenderObjects(RenderSnapshot& snapshot) const
+{
+	snapshot.AddRenderObject(mMeshId, RenderLayer::Ships, mPreviousTransform,
+		RenderTransform{ GetPosition(), GetRotation().AsRadians() }, TyreBytes::ColorPalette::Pink);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void Asteroids::RocketShipEntity::OnCollide(const tbGame::Entity& otherEntity)
 {
 	tbGame::Entity::OnCollide(otherEntity);
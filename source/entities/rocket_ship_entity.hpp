@@ -9,12 +9,13 @@
 #define Asteroids_RocketShipEntity_hpp
 
 #include "../asteroids.hpp"
-#include "../graphics/rocket_ship_shape.hpp"
+#include "../graphics/mesh_library.hpp"
+#include "../graphics/render_snapshot.hpp"
 
 namespace Asteroids
 {
 
-	class RocketShipEntity : public tbGame::Entity
+	class RocketShipEntity : public tbGame::Entity, public RenderObjectWriter
 	{
 	public:
 		explicit RocketShipEntity(const Vector2& position = tbGraphics::ScreenCenter());
@@ -27,6 +28,7 @@ namespace Asteroids
 		virtual void OnUpdate(const float deltaTime) override;
 		virtual void OnRender(void) const override;
 		virtual void OnCollide(const tbGame::Entity& otherEntity) override;
+		virtual void OnWriteRenderObjects(RenderSnapshot& snapshot) const override;
 
 	private:
 		tbGame::InputAction mThrustForward;
@@ -39,7 +41,8 @@ namespace Asteroids
 		tbGame::InputAction mShootWeapon;
 
 		RustyTimer mWeaponReloadTimer;
-		RocketShipShape mShape;
+		MeshId mMeshId;
+		RenderTransform mPreviousTransform; //before the last OnSimulate(), to blend from when rendering.
 		Vector2 mLinearVelocity;
 		Angle mAngularVelocity;
 	};
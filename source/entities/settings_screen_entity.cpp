@@ -41,6 +41,8 @@ namespace
 		//   fills the options in with TOO MANY OPTIONS. Currently the dropdown box doesn't support a scrollbar so it
 		//   will eh, fall of the screen... Hence we will run with "just guessing" some common resolutions and let the
 		//   players choose what works.
+		// 2026-10-19: SimpleDropdown now only creates the rows that fit and scrolls through the rest, so a long list
+		//   no longer falls off the screen. The guessing stays until GetSupportedResolutions() works off Windows.
 		const std::vector<tbApplication::WindowProperties> maybeSupported = {
 			MakeResolution(1024, 768, false),
 			MakeResolution(1280, 720, false),
@@ -213,6 +215,7 @@ void Asteroids::SettingsScreenEntity::OnUpdate(const float deltaTime)
 	mInterfaceController.SetInterfaceScale(1.0f / Interface::Scale());
 
 	mInterface.Update(mInterfaceController);
+	mResolutionDropdown.UpdateScrolling();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -13,7 +13,13 @@
 #include "scenes/scene_manager.hpp"
 
 #include <turtle_brains/core/tb_file_utilities.hpp>
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
 
+#include <bit>
+#include <bitset>
+#include <chrono>
+#include <cmath>
+#include <limits>
 #include <unordered_set>
 
 namespace Asteroids
@@ -25,18 +31,150 @@ namespace Asteroids
 		tbCore::uint32 kAsteroidsSaveVersion = 1;
 	};
 
-	const std::vector<std::pair<Stat, String>> kStatToNameTable{
-		{ Stat::TotalPlayTime, "TOTAL_PLAY_TIME" },
-		{ Stat::TotalActiveTime, "TOTAL_ACTIVE_TIME" },
+	namespace Implementation
+	{
+		struct StatNames
+		{
+			StringView mName;
+			StringView mPlayerName;
+			StringView mPlayerNamePlural;
+		};
+
+		constexpr std::array<StatNames, static_cast<size_t>(Stat::NumberOfStats)> kStatNames = { {
+		#define asteroids_stat_names(name, statName, playerName, playerNamePlural) StatNames{ statName, playerName, playerNamePlural },
+			asteroids_stat_table(asteroids_stat_names)
+		#undef asteroids_stat_names
+		} };
+
+		constexpr char UppercaseCharacter(const char character)
+		{
+			return ('a' <= character && character <= 'z') ? static_cast<char>(character - 'a' + 'A') : character;
+		}
+
+		constexpr bool IsSameIgnoringCase(const StringView& name, const StringView& upperName)
+		{
+			if (name.size() != upperName.size())
+			{
+				return false;
+			}
+
+			for (size_t index = 0; index < name.size(); ++index)
+			{
+				if (UppercaseCharacter(name[index]) != upperName[index])
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		//FNV-1a of the uppercase name, the seed is searched for at compile time so no two stats share a slot.
+		constexpr tbCore::uint32 HashStatName(const StringView& name, const tbCore::uint32 seed)
+		{
+			tbCore::uint32 hash = 2166136261u ^ seed;
+			for (const char character : name)
+			{
+				hash ^= static_cast<tbCore::uint8>(UppercaseCharacter(character));
+				hash *= 16777619u;
+			}
+
+			return hash;
+		}
+
+		constexpr size_t kStatHashSlots = std::bit_ceil(static_cast<size_t>(Stat::NumberOfStats) * 2);
+		constexpr tbCore::uint32 kMaximumStatHashSeed = 1000000;
+
+		struct StatHashTable
+		{
+			tbCore::uint32 mSeed = kMaximumStatHashSeed;
+			std::array<Stat, kStatHashSlots> mSlots{};
+		};
+
+		constexpr StatHashTable MakeStatHashTable(void)
+		{
+			for (tbCore::uint32 seed = 0; seed < kMaximumStatHashSeed; ++seed)
+			{
+				StatHashTable table;
+				table.mSeed = seed;
+				table.mSlots.fill(Stat::Unknown);
+
+				bool isPerfect = true;
+				for (size_t statIndex = 0; statIndex < kStatNames.size() && true == isPerfect; ++statIndex)
+				{
+					Stat& slot = table.mSlots[HashStatName(kStatNames[statIndex].mName, seed) & (kStatHashSlots - 1)];
+					isPerfect = (Stat::Unknown == slot);
+					slot = static_cast<Stat>(statIndex);
+				}
+
+				if (true == isPerfect)
+				{
+					return table;
+				}
+			}
+
+			return StatHashTable();
+		}
 
-		{ Stat::Level, "LEVEL" },
-		{ Stat::Experience, "XP" },
+		constexpr StatHashTable kStatHashTable = MakeStatHashTable();
+		static_assert(kStatHashTable.mSeed < kMaximumStatHashSeed, "Expected to find a perfect hash for the stat names.");
+
+		constexpr Stat FindStat(const StringView& statName)
+		{
+			const Stat stat = kStatHashTable.mSlots[HashStatName(statName, kStatHashTable.mSeed) & (kStatHashSlots - 1)];
+			if (Stat::Unknown != stat && true == IsSameIgnoringCase(statName, kStatNames[static_cast<size_t>(stat)].mName))
+			{
+				return stat;
+			}
+
+			return Stat::Unknown;
+		}
+
+		constexpr bool IsEveryStatFound(void)
+		{
+			for (size_t statIndex = 0; statIndex < kStatNames.size(); ++statIndex)
+			{
+				if (static_cast<Stat>(statIndex) != FindStat(kStatNames[statIndex].mName))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		//Also catches two stats given the same name, or a name that is not uppercase.
+		static_assert(true == IsEveryStatFound(), "Expected every stat to be found by its own name.");
+
+		constexpr bool IsEveryUnlockKeyFound(void)
+		{
+			for (UnlockKeys::KeyId keyId = 0; keyId < UnlockKeys::kNumberOfKeys; ++keyId)
+			{
+				if (keyId != UnlockKeys::FindKeyId(UnlockKeys::theAllowedKeys[keyId]))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		//Also catches a key allowed twice, or one that is not lowercase, either would never be found as a bit.
+		static_assert(true == IsEveryUnlockKeyFound(), "Expected every unlock key to be found by its own name.");
+		static_assert(UnlockKeys::kUnknownKey == UnlockKeys::FindKeyId("not_a_key"), "Expected unknown keys to have no id.");
+		static_assert(UnlockKeys::Id("DEFAULT_KEY") == UnlockKeys::Id(UnlockKeys::DefaultKey), "Expected ids to ignore case.");
 	};
 
 	namespace GameManager
 	{
+		void TouchAllStatsAndKeys(void);
+
 		std::array<GameStats, GetNumberOfProfiles()> theGameStats;
-		std::array<std::unordered_set<String>, GetNumberOfProfiles()> theUnlockedKeys;
+		std::array<std::bitset<UnlockKeys::kNumberOfKeys>, GetNumberOfProfiles()> theUnlockedKeys;
+		std::array<std::unordered_set<String>, GetNumberOfProfiles()> theUnlockedOtherKeys; //not in theAllowedKeys, lowercase.
+
+		std::array<size_t, static_cast<int>(Stat::NumberOfStats)> theStatRevisions = { 0, };
+		size_t theUnlockRevision = 0;
 
 		int theActiveProfile = 0;
 
@@ -67,19 +205,79 @@ Asteroids::StatType Asteroids::GameManager::CalculateExperienceForLevel(const in
 	return tbMath::Maximum(50.0 * level * level + 50.0 * level, StatType(0.0));
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+
+int Asteroids::GameManager::CalculateLevelForExperience(const StatType& experience)
+{
+	if (experience <= CalculateExperienceForLevel(1))
+	{
+		return 1;
+	}
+
+	//Solving 50L^2 + 50L = experience for L, then nudging by a level when the floating point lands on the wrong side.
+	const StatType solvedLevel = std::ceil((-1.0 + std::sqrt(1.0 + 4.0 * experience / 50.0)) / 2.0);
+	int level = static_cast<int>(tbMath::Minimum<StatType>(solvedLevel, std::numeric_limits<int>::max() - 1));
+
+	while (CalculateExperienceForLevel(level) < experience && level < std::numeric_limits<int>::max() - 1)
+	{
+		++level;
+	}
+
+	while (level > 1 && CalculateExperienceForLevel(level - 1) >= experience)
+	{
+		--level;
+	}
+
+	return level;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+int Asteroids::GameManager::SearchLevelForExperience(const StatType& experience,
+	const std::function<StatType(int)>& experienceForLevel)
+{
+	//Double until a level covers the experience, then search between that and half of it.
+	int lowLevel = 1;
+	int highLevel = 1;
+	while (experienceForLevel(highLevel) < experience)
+	{
+		if (highLevel > std::numeric_limits<int>::max() / 2)
+		{
+			return std::numeric_limits<int>::max();
+		}
+
+		lowLevel = highLevel + 1;
+		highLevel *= 2;
+	}
+
+	while (lowLevel < highLevel)
+	{
+		const int middleLevel = lowLevel + (highLevel - lowLevel) / 2;
+		if (experienceForLevel(middleLevel) < experience)
+		{
+			lowLevel = middleLevel + 1;
+		}
+		else
+		{
+			highLevel = middleLevel;
+		}
+	}
+
+	return lowLevel;
+}
+
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 
 Asteroids::String Asteroids::MakePlayerFacingName(const Stat& input, bool plural)
 {
-	const std::unordered_map<Stat, std::pair<String, String>> kStatToPlayerName{
-		{ Stat::Experience, { NotLocalized("XP"), NotLocalized("XP") } },
-		{ Stat::Level, { NotLocalized("Level"), NotLocalized("Levels") } },
-	};
+	const bool isKnown = (static_cast<size_t>(input) < Implementation::kStatNames.size());
+	tb_error_if(false == isKnown || true == Implementation::kStatNames[static_cast<size_t>(input)].mPlayerName.empty(),
+		"Expected to find Stat(%d) to convert for UI string.", input);
 
-	tb_error_if(false == kStatToPlayerName.contains(input), "Expected to find Stat(%d) to convert for UI string.", input);
-	return (true == plural) ? kStatToPlayerName.at(input).second : kStatToPlayerName.at(input).first;
+	const Implementation::StatNames& names = Implementation::kStatNames[static_cast<size_t>(input)];
+	return NotLocalized(String((true == plural) ? names.mPlayerNamePlural : names.mPlayerName));
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -88,30 +286,14 @@ Asteroids::String Asteroids::MakePlayerFacingName(const Stat& input, bool plural
 
 bool Asteroids::UnlockKeys::VerifyKeyExists(const StringView& key)
 {
-	for (const StringView& availableKey : UnlockKeys::theAllowedKeys)
-	{
-		if (tbCore::StringUtilities::Lowercase(String(key)) == tbCore::StringUtilities::Lowercase(String(availableKey)))
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return (kUnknownKey != FindKeyId(key));
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 bool Asteroids::UnlockKeys::VerifyKeyExists(const String& key)
 {
-	for (const StringView& availableKey : UnlockKeys::theAllowedKeys)
-	{
-		if (tbCore::StringUtilities::Lowercase(key) == tbCore::StringUtilities::Lowercase(String(availableKey)))
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return (kUnknownKey != FindKeyId(key));
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -130,34 +312,35 @@ void Asteroids::VerifyStatsHaveNames(void)
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 
-template<> Asteroids::Stat Asteroids::FromString(const String& input)
+Asteroids::Stat Asteroids::StatFromName(const StringView& statName)
 {
-	const String upper = tbCore::StringUtilities::Uppercase(input);
+	return Implementation::FindStat(statName);
+}
 
-	for (auto& statNamePair : kStatToNameTable)
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::StringView Asteroids::StatToName(const Stat& statIndex)
+{
+	if (static_cast<size_t>(statIndex) < Implementation::kStatNames.size())
 	{
-		if (statNamePair.second == upper)
-		{
-			return statNamePair.first;
-		}
+		return Implementation::kStatNames[static_cast<size_t>(statIndex)].mName;
 	}
 
-	return Stat::Unknown;
+	return "UNKNOWN_STAT";
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-template<> Asteroids::String Asteroids::ToString(const Stat& input)
+template<> Asteroids::Stat Asteroids::FromString(const String& input)
 {
-	for (auto& statNamePair : kStatToNameTable)
-	{
-		if (statNamePair.first == input)
-		{
-			return statNamePair.second;
-		}
-	}
+	return StatFromName(input);
+}
 
-	return "UNKNOWN_STAT";
+//--------------------------------------------------------------------------------------------------------------------//
+
+template<> Asteroids::String Asteroids::ToString(const Stat& input)
+{
+	return String(StatToName(input));
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -175,6 +358,7 @@ void Asteroids::GameManager::SetActiveProfile(size_t profileIndex)
 {
 	tb_error_if(profileIndex >= GetNumberOfProfiles(), "Expected valid profileIndex.");
 	theActiveProfile = static_cast<int>(profileIndex);
+	TouchAllStatsAndKeys();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -189,7 +373,9 @@ void Asteroids::GameManager::ResetProfile(void)
 void Asteroids::GameManager::ResetProfile(const size_t profileIndex)
 {
 	theGameStats[profileIndex] = GameStats();
-	theUnlockedKeys[profileIndex].clear();
+	theUnlockedKeys[profileIndex].reset();
+	theUnlockedOtherKeys[profileIndex].clear();
+	TouchAllStatsAndKeys();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -203,6 +389,8 @@ const Asteroids::GameStats& Asteroids::GameManager::GetActiveStats(void)
 
 Asteroids::GameStats& Asteroids::GameManager::GetMutableActiveStats()
 {
+	//Any of the stats could be changed through this, so anything watching any of them needs to look again.
+	TouchAllStatsAndKeys();
 	return theGameStats[theActiveProfile];
 }
 
@@ -217,21 +405,80 @@ const Asteroids::StatType& Asteroids::GameManager::GetStat(const Stat& statIndex
 
 const Asteroids::StatType& Asteroids::GameManager::GetStat(const StringView& statName)
 {
-	return GetActiveStats()[String(statName)];
+	return GetActiveStats()[statName];
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 Asteroids::StatType& Asteroids::GameManager::GetMutableStat(const Stat& statIndex)
 {
-	return GetMutableActiveStats()[statIndex];
+	++theStatRevisions[static_cast<int>(statIndex)];
+	return theGameStats[theActiveProfile][statIndex];
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 Asteroids::StatType& Asteroids::GameManager::GetMutableStat(const StringView& statName)
 {
-	return GetMutableActiveStats()[statName];
+	const Stat statIndex = StatFromName(statName);
+	if (Stat::Unknown != statIndex)
+	{
+		++theStatRevisions[static_cast<int>(statIndex)];
+	}
+
+	return theGameStats[theActiveProfile][statName];
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::GameManager::SetStat(const Stat& statIndex, const StatType& value)
+{
+	StatType& statValue = theGameStats[theActiveProfile][statIndex];
+	if (value != statValue)
+	{
+		statValue = value;
+		++theStatRevisions[static_cast<int>(statIndex)];
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::GameManager::GetStatRevision(const Stat& statIndex)
+{
+	return theStatRevisions[static_cast<int>(statIndex)];
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::GameManager::GetUnlockRevision(void)
+{
+	return theUnlockRevision;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::GameManager::GetDependencyRevision(const std::vector<Stat>& stats, const bool includeUnlockKeys)
+{
+	//The revisions only ever count up, so the sum changes if, and only if, one of them changed.
+	size_t revision = (true == includeUnlockKeys) ? theUnlockRevision : 0;
+	for (const Stat& statIndex : stats)
+	{
+		revision += theStatRevisions[static_cast<int>(statIndex)];
+	}
+
+	return revision;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::GameManager::TouchAllStatsAndKeys(void)
+{
+	for (size_t& statRevision : theStatRevisions)
+	{
+		++statRevision;
+	}
+
+	++theUnlockRevision;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -301,7 +548,7 @@ Asteroids::StatType Asteroids::GameManager::GetExperienceForCurrentLevel(void)
 
 void Asteroids::GameManager::GainExperience(const StatType& value)
 {
-	GetMutableStat(Stat::Experience) += value;
+	SetStat(Stat::Experience, GetStat(Stat::Experience) + value);
 	CheckForLevelUp();
 }
 
@@ -309,57 +556,80 @@ void Asteroids::GameManager::GainExperience(const StatType& value)
 
 int Asteroids::GameManager::CheckForLevelUp(void)
 {
-	int levelsGained = 0;
-	while (GameManager::GetStat(Stat::Experience) > GetExperienceForNextLevel())
+	// 2026-10-19: This used to gain one level at a time, logging each, so a huge amount of experience could loop and
+	//   log thousands of times in a single step. Now the level is worked out from the experience in one go.
+	const int previousLevel = GetStatAsInteger(Stat::Level);
+	const int level = CalculateLevelForExperience(GameManager::GetStat(Stat::Experience));
+	if (level <= previousLevel)
 	{
-		GetMutableStat(Stat::Level) += 1.0;
-
-		{	// TODO: Asteroids: Develoment: 2025-10-16: This would be a great tool to write out the history of play and
-			//   track through multiple sessions if necessary.
-			tb_always_log(LogState::Always() << DebugInfo::PlayTimeHistory() << "Level Up " <<
-				GetStatAsIntegerString(Stat::Level) << " with a total of " << GetStatAsIntegerString(Stat::Experience) << " fame.");
-		}
+		return 0;
+	}
 
-		//if (GetStatAsInteger(Stat::Level) >= 10 && 0 == GetStatAsInteger(Stat::Level) % 5)
-		//{	// 2025-10-22: This is a special chain link that is given to unlock the ChallengerMode through tech tree.
-		//	//   Once player buys their "race car" they can gain chain links through minions that then allow them to
-		//	//   continue racing the 'bosses' of the challenge/race mode.
-		//	GameManager::GetMutableStat(Stat::ChainLinks) += 1.0;
-		//}
+	SetStat(Stat::Level, static_cast<StatType>(level));
+	const int levelsGained = level - previousLevel;
 
-		++levelsGained;
+	{	// TODO: Asteroids: Develoment: 2025-10-16: This would be a great tool to write out the history of play and
+		//   track through multiple sessions if necessary.
+		tb_always_log(LogState::Always() << DebugInfo::PlayTimeHistory() << "Level Up " <<
+			GetStatAsIntegerString(Stat::Level) << " (+" << levelsGained << ") with a total of " <<
+			GetStatAsIntegerString(Stat::Experience) << " fame.");
 	}
 
+	//{	// 2025-10-22: This is a special chain link that is given to unlock the ChallengerMode through tech tree.
+	//	//   Once player buys their "race car" they can gain chain links through minions that then allow them to
+	//	//   continue racing the 'bosses' of the challenge/race mode. One for every 5th level from 10 that was passed.
+	//	const auto chainLinksUpTo = [](const int toLevel) { return (toLevel < 10) ? 0 : (toLevel / 5) - 1; };
+	//	GameManager::GetMutableStat(Stat::ChainLinks) += chainLinksUpTo(level) - chainLinksUpTo(previousLevel);
+	//}
+
 	return levelsGained;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+bool Asteroids::GameManager::IsUnlocked(const UnlockKeys::KeyId keyId)
+{
+	tb_error_if(keyId >= UnlockKeys::kNumberOfKeys, "Expected a valid UnlockKeys::KeyId.");
+	return theUnlockedKeys[theActiveProfile].test(keyId);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 bool Asteroids::GameManager::IsUnlocked(const String& keyName)
 {
-	return theUnlockedKeys[theActiveProfile].contains(tbCore::StringUtilities::Lowercase(keyName));
+	return IsUnlocked(StringView(keyName));
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 bool Asteroids::GameManager::IsUnlocked(const StringView& keyName)
 {
-	return IsUnlocked(String(keyName));
+	const UnlockKeys::KeyId keyId = UnlockKeys::FindKeyId(keyName);
+	if (UnlockKeys::kUnknownKey != keyId)
+	{
+		return IsUnlocked(keyId);
+	}
+
+	return theUnlockedOtherKeys[theActiveProfile].contains(tbCore::StringUtilities::Lowercase(String(keyName)));
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::GameManager::UnlockKey(const String& keyName)
+void Asteroids::GameManager::UnlockKey(const UnlockKeys::KeyId keyId)
 {
-	if (true == theUnlockedKeys[theActiveProfile].insert(tbCore::StringUtilities::Lowercase(keyName)).second)
+	tb_error_if(keyId >= UnlockKeys::kNumberOfKeys, "Expected a valid UnlockKeys::KeyId.");
+	if (false == theUnlockedKeys[theActiveProfile].test(keyId))
 	{
+		theUnlockedKeys[theActiveProfile].set(keyId);
+		++theUnlockRevision;
+
 		//const std::unordered_map<StringView, String> unlockKeyToSteamAchievements = {
 		//	{ UnlockKeys::FirstLootPickedUp, "collected_first_bolt" },
 		//	{ UnlockKeys::Quest_LittleLeader, "the_little_leader" },
 		//};
 
 		////if (true == unlockKeyToSteamAchievements.contains(keyName))
-		//const auto& steamAchievementIterator = unlockKeyToSteamAchievements.find(keyName);
+		//const auto& steamAchievementIterator = unlockKeyToSteamAchievements.find(UnlockKeys::theAllowedKeys[keyId]);
 		//if (steamAchievementIterator != unlockKeyToSteamAchievements.end())
 		//{
 		//	ToolBox::Achievements::UnlockAchievement(steamAchievementIterator->second);
@@ -369,9 +639,24 @@ void Asteroids::GameManager::UnlockKey(const String& keyName)
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void Asteroids::GameManager::UnlockKey(const String& keyName)
+{
+	UnlockKey(StringView(keyName));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void Asteroids::GameManager::UnlockKey(const StringView& keyName)
 {
-	return UnlockKey(String(keyName));
+	const UnlockKeys::KeyId keyId = UnlockKeys::FindKeyId(keyName);
+	if (UnlockKeys::kUnknownKey != keyId)
+	{
+		UnlockKey(keyId);
+	}
+	else if (true == theUnlockedOtherKeys[theActiveProfile].insert(tbCore::StringUtilities::Lowercase(String(keyName))).second)
+	{
+		++theUnlockRevision;
+	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -391,7 +676,24 @@ bool Asteroids::GameManager::UnlockFirstTimeKey(const StringView& firstKey, cons
 
 bool Asteroids::GameManager::LockKey(const String& keyName, const ThisShouldBeRare /*reallyLock*/)
 {
-	return (0 != theUnlockedKeys[theActiveProfile].erase(tbCore::StringUtilities::Lowercase(String(keyName))));
+	const UnlockKeys::KeyId keyId = UnlockKeys::FindKeyId(keyName);
+	bool wasUnlocked = false;
+	if (UnlockKeys::kUnknownKey != keyId)
+	{
+		wasUnlocked = theUnlockedKeys[theActiveProfile].test(keyId);
+		theUnlockedKeys[theActiveProfile].reset(keyId);
+	}
+	else
+	{
+		wasUnlocked = (0 != theUnlockedOtherKeys[theActiveProfile].erase(tbCore::StringUtilities::Lowercase(keyName)));
+	}
+
+	if (true == wasUnlocked)
+	{
+		++theUnlockRevision;
+	}
+
+	return wasUnlocked;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -428,9 +730,12 @@ void Asteroids::GameManager::ResetGameToDefaults(void)
 {
 	for (size_t profileIndex = 0; profileIndex < GetNumberOfProfiles(); ++profileIndex)
 	{
-		theUnlockedKeys[profileIndex].clear();
+		theUnlockedKeys[profileIndex].reset();
+		theUnlockedOtherKeys[profileIndex].clear();
 		theGameStats[profileIndex] = GameStats();
 	}
+
+	TouchAllStatsAndKeys();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -440,7 +745,15 @@ void Asteroids::GameManager::SaveGame(void)
 	for (size_t profileIndex = 0; profileIndex < GetNumberOfProfiles(); ++profileIndex)
 	{
 		DynamicStructure unlockedKeysData;
-		for (const String& unlockedKey : theUnlockedKeys[profileIndex])
+		for (UnlockKeys::KeyId keyId = 0; keyId < UnlockKeys::kNumberOfKeys; ++keyId)
+		{
+			if (true == theUnlockedKeys[profileIndex].test(keyId))
+			{
+				unlockedKeysData.PushValue(String(UnlockKeys::theAllowedKeys[keyId]));
+			}
+		}
+
+		for (const String& unlockedKey : theUnlockedOtherKeys[profileIndex])
 		{
 			unlockedKeysData.PushValue(unlockedKey);
 		}
@@ -544,7 +857,7 @@ void Asteroids::GameManager::LoadGame(void)
 
 			if (true == GetActiveStats().Contains(statName))
 			{
-				GetMutableStat(statName) = statValue;
+				SetStat(StatFromName(statName), statValue);
 			}
 			else
 			{
@@ -556,8 +869,125 @@ void Asteroids::GameManager::LoadGame(void)
 	}
 
 	theActiveProfile = originalActiveProfile;
+	TouchAllStatsAndKeys();
 
 	tb_debug_log_if(false, "Pretending to use failed to load: " << failedToLoad);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class StatNameTableTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		StatNameTableTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::StatNameTableTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			for (size_t statIndex = 0; statIndex < static_cast<size_t>(Stat::NumberOfStats); ++statIndex)
+			{
+				const Stat stat = static_cast<Stat>(statIndex);
+				const String name = ToString(stat);
+				ExpectedValue(FromString<Stat>(name) == stat, true, "Expected each stat to be found by its name.");
+				ExpectedValue(StatFromName(tbCore::StringUtilities::Lowercase(name)) == stat, true,
+					"Expected the stat names to be found ignoring case.");
+			}
+
+			ExpectedValue(StatFromName("Level") == Stat::Level, true, "Expected mixed case to find the stat.");
+			ExpectedValue(StatFromName("") == Stat::Unknown, true, "Expected no stat for an empty name.");
+			ExpectedValue(StatFromName("LEVELS") == Stat::Unknown, true, "Expected no stat for a name that is too long.");
+			ExpectedValue(StatFromName("NOT_A_STAT") == Stat::Unknown, true, "Expected no stat for an unknown name.");
+			ExpectedValue(ToString(Stat::Unknown), String("UNKNOWN_STAT"), "Expected the unknown stat to have a name.");
+			ExpectedValue(MakePlayerFacingName(Stat::Level, true), String("Levels"), "Expected the plural player-facing name.");
+
+			{	//Benchmark every stat name through the lookup, reported rather than expected so it never fails a slow machine.
+				const size_t kIterations = 10000;
+				std::vector<String> names;
+				for (size_t statIndex = 0; statIndex < static_cast<size_t>(Stat::NumberOfStats); ++statIndex)
+				{
+					names.push_back(tbCore::StringUtilities::Lowercase(ToString(static_cast<Stat>(statIndex))));
+				}
+
+				size_t foundCount = 0;
+				const auto benchmarkStart = std::chrono::steady_clock::now();
+				for (size_t iteration = 0; iteration < kIterations; ++iteration)
+				{
+					for (const String& name : names)
+					{
+						foundCount += (Stat::Unknown != StatFromName(name)) ? 1 : 0;
+					}
+				}
+
+				const std::chrono::duration<double, std::nano> benchmarkTime = std::chrono::steady_clock::now() - benchmarkStart;
+				ExpectedValue(foundCount, kIterations * names.size(), "Expected every lookup in the benchmark to be found.");
+				tb_always_log(LogGame::Info() << "StatFromName() took " << benchmarkTime.count() / static_cast<double>(foundCount) <<
+					"ns per lookup over " << names.size() << " stat names.");
+			}
+
+			return true;
+		}
+	};
+
+	StatNameTableTest theStatNameTableTest;
+
+	class ExperienceCurveTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		ExperienceCurveTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::ExperienceCurveTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace GameManager;
+
+			//The level the one-at-a-time loop in CheckForLevelUp() used to reach, starting from level 1.
+			const auto loopedLevel = [](const StatType experience) {
+				int level = 1;
+				while (experience > CalculateExperienceForLevel(level))
+				{
+					++level;
+				}
+				return level;
+			};
+
+			bool isMatching = true;
+			for (int level = 1; level < 200; ++level)
+			{
+				const StatType threshold = CalculateExperienceForLevel(level);
+				for (const StatType experience : { threshold - 0.5, threshold, threshold + 0.5 })
+				{
+					isMatching &= (loopedLevel(experience) == CalculateLevelForExperience(experience));
+					isMatching &= (loopedLevel(experience) == SearchLevelForExperience(experience, CalculateExperienceForLevel));
+				}
+			}
+			ExpectedValue(isMatching, true, "Expected the solved and searched levels to match gaining one level at a time.");
+
+			ExpectedValue(CalculateLevelForExperience(0.0), 1, "Expected level 1 without any experience.");
+			ExpectedValue(CalculateLevelForExperience(100.0), 1, "Expected to stay level 1 at exactly the threshold.");
+			ExpectedValue(CalculateLevelForExperience(100.5), 2, "Expected level 2 just past the threshold.");
+
+			const StatType hugeExperience = CalculateExperienceForLevel(1000000) + 1.0;
+			ExpectedValue(CalculateLevelForExperience(hugeExperience), 1000001, "Expected a huge grant to be solved directly.");
+			ExpectedValue(SearchLevelForExperience(hugeExperience, CalculateExperienceForLevel), 1000001,
+				"Expected a huge grant to be searched quickly.");
+
+			return true;
+		}
+	};
+
+	ExperienceCurveTest theExperienceCurveTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
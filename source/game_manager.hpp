@@ -15,6 +15,8 @@
 #include <turtle_brains/core/tb_dynamic_structure.hpp>
 
 #include <array>
+#include <functional>
+#include <vector>
 
 namespace Asteroids
 {
@@ -43,18 +45,84 @@ namespace Asteroids
 		static constexpr std::array theEditorKeys = {
 			DefaultKey,
 		};
+
+		// 2026-10-19: Each allowed key has a dense index, its position in theAllowedKeys, and the profiles keep those
+		//   as bits. The key names are only needed when saving, loading or typing them into the console.
+		using KeyId = size_t;
+		static constexpr KeyId kUnknownKey = static_cast<KeyId>(-1);
+		static constexpr size_t kNumberOfKeys = theAllowedKeys.size();
+
+		///
+		/// @details The index of the allowed key, ignoring case and without allocating, or kUnknownKey.
+		///
+		static constexpr KeyId FindKeyId(const StringView& key)
+		{
+			for (KeyId keyId = 0; keyId < kNumberOfKeys; ++keyId)
+			{
+				if (true == IsSameIgnoringCase(key, theAllowedKeys[keyId]))
+				{
+					return keyId;
+				}
+			}
+
+			return kUnknownKey;
+		}
+
+		///
+		/// @details The index of a key typed in code, a typo fails to compile rather than quietly never unlocking.
+		///   GameManager::IsUnlocked(UnlockKeys::Id(UnlockKeys::DefaultKey)) is then only a bit test.
+		///
+		static consteval KeyId Id(const StringView& key)
+		{
+			const KeyId keyId = FindKeyId(key);
+			if (kUnknownKey == keyId)
+			{
+				ExpectedKeyInTheAllowedKeys();
+			}
+
+			return keyId;
+		}
+
+	private:
+		static void ExpectedKeyInTheAllowedKeys(void); //never defined, only called at compile time to fail Id().
+
+		static constexpr bool IsSameIgnoringCase(const StringView& key, const StringView& lowerKey)
+		{
+			if (key.size() != lowerKey.size())
+			{
+				return false;
+			}
+
+			for (size_t index = 0; index < key.size(); ++index)
+			{
+				const char character = key[index];
+				if ((('A' <= character && character <= 'Z') ? static_cast<char>(character - 'A' + 'a') : character) != lowerKey[index])
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
 	};
 
 	// 2025-10-06: To add a new game stat, whether that is a resource to collect or a stat that changes how the resources
 	//   get collected, simply add to this enum the name of the 'variable'. It will be a double (or whatever StatType is)
 	//   and if you need to set a default value jump to the GameStats constructor and set it after the loop.
-	enum class Stat {
-		TotalPlayTime,
-		TotalActiveTime,
-
-		Level,
-		Experience,
+	//
+	// 2026-10-19: The enum, the name used by save files, csv and the console, and the player-facing names all come from
+	//   this one table now, so add the stat here rather than to the enum. Leave the player-facing names empty for stats
+	//   the player never sees by name.
+	#define asteroids_stat_table(stat) \
+		stat(TotalPlayTime,   "TOTAL_PLAY_TIME",   "",      "") \
+		stat(TotalActiveTime, "TOTAL_ACTIVE_TIME", "",      "") \
+		stat(Level,           "LEVEL",             "Level", "Levels") \
+		stat(Experience,      "XP",                "XP",    "XP")
 
+	enum class Stat {
+	#define asteroids_stat_enum(name, statName, playerName, playerNamePlural) name,
+		asteroids_stat_table(asteroids_stat_enum)
+	#undef asteroids_stat_enum
 
 		NumberOfStats,
 		Unknown
@@ -67,6 +135,13 @@ namespace Asteroids
 
 	using StatType = double;
 
+	///
+	/// @details Finds the stat from the name used by save files, csv and the console, ignoring case, with a perfect hash
+	///   built at compile time; it neither allocates nor scans the table. Stat::Unknown when there is no such stat.
+	///
+	Stat StatFromName(const StringView& statName);
+	StringView StatToName(const Stat& statIndex);
+
 	template<> Stat FromString(const String& input);
 	template<> String ToString(const Stat& input);
 
@@ -80,7 +155,7 @@ namespace Asteroids
 
 		bool Contains(const StringView& statName) const
 		{
-			return (Stat::Unknown != FromString<Stat>(String(statName)));
+			return (Stat::Unknown != StatFromName(statName));
 		}
 
 		const StatType& operator[](const Stat& statIndex) const
@@ -99,7 +174,7 @@ namespace Asteroids
 			tb_error_if(false == Contains(statName), "Expected statName='%s' to exist as a StatIndex, potential typo?", statName.data());
 #endif /* debug_build */
 
-			return (*this)[FromString<Stat>(String(statName))];
+			return (*this)[StatFromName(statName)];
 		}
 
 		// The const StatType* that gets const_casted to a StatType* is part of THIS object. THIS object is non-const as per
@@ -111,7 +186,7 @@ namespace Asteroids
 			tb_error_if(false == Contains(statName), "Expected statName='%s' to exist as a StatIndex, potential typo?", statName.data());
 #endif /* debug_build */
 
-			return (*this)[FromString<Stat>(String(statName))];
+			return (*this)[StatFromName(statName)];
 		}
 	};
 
@@ -122,6 +197,18 @@ namespace Asteroids
 		///
 		StatType CalculateExperienceForLevel(const int level);
 
+		///
+		/// @details The inverse of CalculateExperienceForLevel(), the lowest level, at least 1, whose experience is not
+		///   exceeded. Worked out from the curve directly so a huge amount of experience costs no more than a little.
+		///
+		int CalculateLevelForExperience(const StatType& experience);
+
+		///
+		/// @details The same inverse for any experience curve that never decreases, like one read from a table, by a
+		///   binary search over the levels; for when the curve has no closed form to solve.
+		///
+		int SearchLevelForExperience(const StatType& experience, const std::function<StatType(int)>& experienceForLevel);
+
 		///
 		constexpr size_t GetNumberOfProfiles(void) { return 3; }
 		size_t GetActiveProfile(void);
@@ -137,9 +224,27 @@ namespace Asteroids
 		const StatType& GetStat(const Stat& statIndex);
 		StatType& GetMutableStat(const StringView& statName);
 		StatType& GetMutableStat(const Stat& statIndex);
+
+		///
+		/// @details Unlike GetMutableStat() the revision of the stat only changes when the value does.
+		///
+		void SetStat(const Stat& statIndex, const StatType& value);
 		//const StatType& GetStat(const String& statName);
 		//StatType& GetMutableStat(const String& statName);
 
+		///
+		/// @details Each stat counts the times it changed through SetStat(), or may have changed because mutable access
+		///   was given out, and the unlock keys count the times one was unlocked or locked. Something that only depends on a few stats can
+		///   compare against the revision it last saw, rather than checking the stats themselves every frame.
+		///
+		size_t GetStatRevision(const Stat& statIndex);
+		size_t GetUnlockRevision(void);
+
+		///
+		/// @details A single revision for a set of dependencies, it changes whenever any one of them changes.
+		///
+		size_t GetDependencyRevision(const std::vector<Stat>& stats, const bool includeUnlockKeys);
+
 		bool RollForStat(const Stat& statIndex);
 
 		/// @details This is a helper roll function that can roll +/- range by percentage with a minimum. So you could
@@ -154,12 +259,16 @@ namespace Asteroids
 
 		void GainExperience(const StatType& value);
 
-		// Should be called immediately ANYTIME experience is modified, unless throught calling GainExperience().
+		// Should be called immediately ANYTIME experience is modified, unless throught calling GainExperience(). Every
+		//   level gained is applied at once, the returned count is how many.
 		int CheckForLevelUp(void);
 
-		// Keys for progression and unlocking features etc.
+		// Keys for progression and unlocking features etc. Keys outside of theAllowedKeys, like those built from strings,
+		//   still work by name but are kept in a set rather than as a bit.
+		bool IsUnlocked(const UnlockKeys::KeyId keyId);
 		bool IsUnlocked(const String& keyName);
 		bool IsUnlocked(const StringView& keyName);
+		void UnlockKey(const UnlockKeys::KeyId keyId);
 		void UnlockKey(const String& keyName);
 		void UnlockKey(const StringView& keyName);
 		bool UnlockFirstTimeKey(const StringView& firstKey, const StringView& firstKeyDone);
@@ -9,34 +9,128 @@
 #include "../interface.hpp"
 
 #include <turtle_brains/graphics/tb_basic_shapes.hpp>
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::Implementation
+{
+	//Projected radius in screen pixels an asteroid needs to be drawn at each level, the last level has no minimum.
+	const float kDetailLevelRadius[kAsteroidDetailLevels - 1] = { 40.0f, 20.0f };
+	const float kDetailLevelHysteresis = 0.15f;
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+std::vector<tbMath::Vector2> Asteroids::Implementation::BuildAsteroidOutline(const int corners, const float radius)
+{
+	std::vector<Vector2> outline;
+	outline.reserve(static_cast<size_t>(corners));
+
+	for (int section = 0; section < corners; ++section)
+	{
+		const float percentage(static_cast<float>(section) / static_cast<float>(corners));
+		const tbMath::Vector2 direction(sin(percentage * tbMath::kTwoPi), -cos(percentage * tbMath::kTwoPi));
+		outline.push_back(direction * radius);
+	}
+
+	return outline;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+std::vector<tbMath::Vector2> Asteroids::Implementation::DecimateAsteroidOutline(const std::vector<Vector2>& outline,
+	const size_t cornerCount)
+{
+	if (outline.size() <= cornerCount)
+	{
+		return outline;
+	}
+
+	std::vector<Vector2> decimated;
+	decimated.reserve(cornerCount);
+	for (size_t corner = 0; corner < cornerCount; ++corner)
+	{
+		decimated.push_back(outline[(corner * outline.size()) / cornerCount]);
+	}
+
+	return decimated;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+int Asteroids::Implementation::CalculateDetailCorners(const int corners, const int detailLevel)
+{
+	const int detailCorners = corners >> detailLevel;
+	return (detailCorners < kMinimumAsteroidCorners) ? std::min(corners, kMinimumAsteroidCorners) : detailCorners;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+int Asteroids::Implementation::CalculateDetailLevelCount(const int corners)
+{
+	int levelCount = 1;
+	while (levelCount < kAsteroidDetailLevels &&
+		CalculateDetailCorners(corners, levelCount) < CalculateDetailCorners(corners, levelCount - 1))
+	{
+		++levelCount;
+	}
+
+	return levelCount;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+int Asteroids::Implementation::SelectDetailLevel(const int currentLevel, const int levelCount, const float projectedRadius)
+{
+	const int lastLevel = levelCount - 1;
+	int detailLevel = (currentLevel < 0) ? 0 : ((currentLevel > lastLevel) ? lastLevel : currentLevel);
+
+	//Finer while comfortably above the threshold of the finer level, coarser while comfortably below our own.
+	while (detailLevel > 0 && projectedRadius > kDetailLevelRadius[detailLevel - 1] * (1.0f + kDetailLevelHysteresis))
+	{
+		--detailLevel;
+	}
+
+	while (detailLevel < lastLevel && projectedRadius < kDetailLevelRadius[detailLevel] * (1.0f - kDetailLevelHysteresis))
+	{
+		++detailLevel;
+	}
+
+	return detailLevel;
+}
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 Asteroids::AsteroidShape::AsteroidShape(const int corners, const float radius, const Color& color, const Vector2& position) :
+	AsteroidShape(Implementation::BuildAsteroidOutline(corners, radius), radius, color, position)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::AsteroidShape::AsteroidShape(const std::vector<Vector2>& outline, const float radius, const Color& color,
+	const Vector2& position) :
 	mRadius(radius)
 {
 	SetPosition(position);
 	SetColor(color);
 
-	//const tbMath::Vector2 circleCenter(radius, radius);
 	const tbMath::Vector2 circleCenter = Vector2::Zero();
 
 	SetAsTriangleFan();
 	AddVertex(circleCenter, color, tbMath::Vector2(0.5f, 0.5f));
 
-	for (int section = 0; section <= corners; ++section)
+	//The first corner is added again at the end to close the fan.
+	for (size_t corner = 0; corner <= outline.size(); ++corner)
 	{
-		const float percentage(static_cast<float>(section) / static_cast<float>(corners));
-		//tbMath::Vector2 direction(cos(percentage * tbMath::kTwoPi), sin(percentage * tbMath::kTwoPi));
-
-
-		tbMath::Vector2 direction(sin(percentage * tbMath::kTwoPi), -cos(percentage * tbMath::kTwoPi));
-
-		AddVertex(circleCenter + (direction * radius), color, (direction + tbMath::Vector2(1.0f, 1.0f)) / 2.0f);
+		const tbMath::Vector2& point = outline[corner % outline.size()];
+		AddVertex(circleCenter + point, color, (point / radius + tbMath::Vector2(1.0f, 1.0f)) / 2.0f);
 	}
 
 	RecomputeBounds();
-	//SetOrigin(Anchor::Center);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -60,4 +154,50 @@ void Asteroids::AsteroidShape::OnRender(void) const
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class AsteroidDetailLevelTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		AsteroidDetailLevelTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::AsteroidDetailLevelTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace Implementation;
+
+			const std::vector<Vector2> outline = BuildAsteroidOutline(32, 10.0f);
+			ExpectedValue(outline.size(), size_t(32), "Expected one point for each corner.");
+			ExpectedValue(DecimateAsteroidOutline(outline, 8).size(), size_t(8), "Expected the outline decimated to 8 corners.");
+			ExpectedValue(DecimateAsteroidOutline(outline, 8)[2] == outline[8], true, "Expected evenly spaced corners to be kept.");
+			ExpectedValue(DecimateAsteroidOutline(outline, 40).size(), size_t(32), "Expected a short outline to stay the same.");
+
+			ExpectedValue(CalculateDetailCorners(32, 1), 16, "Expected each level to halve the corners.");
+			ExpectedValue(CalculateDetailCorners(8, 1), kMinimumAsteroidCorners, "Expected a minimum number of corners.");
+			ExpectedValue(CalculateDetailLevelCount(5), 1, "Expected nothing to drop from the smallest outline.");
+			ExpectedValue(CalculateDetailLevelCount(8), 2, "Expected a single coarser level for 8 corners.");
+			ExpectedValue(CalculateDetailLevelCount(32), kAsteroidDetailLevels, "Expected every level for a detailed outline.");
+
+			ExpectedValue(SelectDetailLevel(0, 3, 100.0f), 0, "Expected a large asteroid to keep full detail.");
+			ExpectedValue(SelectDetailLevel(0, 3, 5.0f), 2, "Expected a tiny asteroid to drop to the coarsest level.");
+			ExpectedValue(SelectDetailLevel(2, 3, 100.0f), 0, "Expected a growing asteroid to return to full detail.");
+			ExpectedValue(SelectDetailLevel(0, 3, 38.0f), 0, "Expected to hold full detail just under the threshold.");
+			ExpectedValue(SelectDetailLevel(1, 3, 42.0f), 1, "Expected to hold the coarser level just over the threshold.");
+			ExpectedValue(SelectDetailLevel(0, 1, 5.0f), 0, "Expected to stay on the only level there is.");
+
+			return true;
+		}
+	};
+
+	AsteroidDetailLevelTest theAsteroidDetailLevelTest;
+
+};
 
+//--------------------------------------------------------------------------------------------------------------------//
@@ -14,15 +14,60 @@
 #include <turtle_brains/graphics/tb_basic_shapes.hpp>
 #include <turtle_brains/graphics/tb_sprite.hpp>
 
+#include <vector>
+
 namespace Asteroids
 {
 
+	///
+	/// @details Each asteroid mesh is built at up to kAsteroidDetailLevels levels of detail, level 0 is the full outline
+	///   and each level after it has half the corners, never fewer than kMinimumAsteroidCorners.
+	///
+	constexpr int kAsteroidDetailLevels = 3;
+	constexpr int kMinimumAsteroidCorners = 5;
+
+	namespace Implementation
+	{
+		///
+		/// @details The corners of a regular asteroid outline around the origin, starting straight up and going clockwise.
+		///
+		std::vector<Vector2> BuildAsteroidOutline(const int corners, const float radius);
+
+		///
+		/// @details Keeps cornerCount evenly spaced corners of the outline, always including the first. Returns the
+		///   outline unchanged when it has no more than cornerCount corners.
+		///
+		std::vector<Vector2> DecimateAsteroidOutline(const std::vector<Vector2>& outline, const size_t cornerCount);
+
+		int CalculateDetailCorners(const int corners, const int detailLevel);
+
+		///
+		/// @details The number of levels that actually differ for an outline with that many corners, between 1 and
+		///   kAsteroidDetailLevels. A 5 sided asteroid has nothing to drop so it only has level 0.
+		///
+		int CalculateDetailLevelCount(const int corners);
+
+		///
+		/// @details Picks the level of detail for an asteroid covering projectedRadius pixels on screen. A level only
+		///   changes once the radius is well past the threshold between them, so an asteroid sitting right on the
+		///   threshold, or a window being resized, does not flip between meshes every frame.
+		///
+		int SelectDetailLevel(const int currentLevel, const int levelCount, const float projectedRadius);
+	};
+
 	class AsteroidShape : public tbGraphics::PolygonShape
 	{
 	public:
 		explicit AsteroidShape(const int corners = 5, const float radius = 64.0f,
 			const Color& color = tbGraphics::ColorPalette::White, const Vector2& position = Vector2::Zero());
 
+		///
+		/// @details Builds the shape from an outline around the origin, like from DecimateAsteroidOutline(), which
+		///   is drawn as a triangle fan from the center.
+		///
+		AsteroidShape(const std::vector<Vector2>& outline, const float radius,
+			const Color& color = tbGraphics::ColorPalette::White, const Vector2& position = Vector2::Zero());
+
 		virtual ~AsteroidShape(void);
 
 		inline float GetRadius(void) const { return mRadius; }
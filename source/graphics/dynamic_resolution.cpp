@@ -0,0 +1,369 @@
+///
+/// @file
+/// @details Measures how long each frame takes on the CPU and GPU and lowers or raises the internal resolution of the
+///   world target to keep the frame rate steady during heavy moments.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/dynamic_resolution.hpp"
+#include "../shader_system/gl_state_cache.hpp"
+#include "../user_settings.hpp"
+
+// 2025-11-19: The ShaderSystem Implementation depends on the TurtleBrains renderer, for check_gl_errors and other
+//   implementation details. We 'know what we are doing'.
+#define TurtleBrains_LetMeHave_Implementation
+#include <turtle_brains/graphics/implementation/tbi_renderer.hpp>
+#undef TurtleBrains_LetMeHave_Implementation
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Asteroids::Implementation
+{
+	//How much of each new frame time goes into the smoothed time, low enough that a single hitch does not count.
+	const float kFrameTimeSmoothing = 0.1f;
+
+	bool IsTimerQuerySupported(void)
+	{
+#if defined(tb_web)
+		return false;
+#else
+		return (GLEW_VERSION_3_3 || GLEW_ARB_timer_query);
+#endif /* tb_web */
+	}
+
+	float QuantizeScale(const float scale)
+	{
+		return std::round(scale / ResolutionController::kScaleStep) * ResolutionController::kScaleStep;
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Implementation::ResolutionController::ResolutionController(void) :
+	mMinimumScale(0.5f),
+	mMaximumScale(1.0f),
+	mFrameBudget(1000.0f / 60.0f),
+	mScale(1.0f),
+	mSmoothedGPUTime(0.0f),
+	mSmoothedCPUTime(0.0f),
+	mFramesOverBudget(0),
+	mFramesUnderBudget(0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Implementation::ResolutionController::SetBounds(const float minimumScale, const float maximumScale)
+{
+	mMinimumScale = std::clamp(QuantizeScale(minimumScale), kScaleStep, 1.0f);
+	mMaximumScale = std::clamp(QuantizeScale(maximumScale), mMinimumScale, 1.0f);
+	mScale = std::clamp(mScale, mMinimumScale, mMaximumScale);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Implementation::ResolutionController::SetFrameBudget(const float budgetMilliseconds)
+{
+	mFrameBudget = std::max(1.0f, budgetMilliseconds);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Asteroids::Implementation::ResolutionController::AddFrameTime(const float gpuMilliseconds, const float cpuMilliseconds)
+{
+	mSmoothedGPUTime = (mSmoothedGPUTime <= 0.0f) ? gpuMilliseconds :
+		mSmoothedGPUTime + (gpuMilliseconds - mSmoothedGPUTime) * kFrameTimeSmoothing;
+	mSmoothedCPUTime = (mSmoothedCPUTime <= 0.0f) ? cpuMilliseconds :
+		mSmoothedCPUTime + (cpuMilliseconds - mSmoothedCPUTime) * kFrameTimeSmoothing;
+
+	const bool isCPUBound = (mSmoothedCPUTime > mFrameBudget * kLowerThreshold && mSmoothedCPUTime > mSmoothedGPUTime);
+
+	if (mSmoothedGPUTime > mFrameBudget * kLowerThreshold)
+	{
+		++mFramesOverBudget;
+		mFramesUnderBudget = 0;
+	}
+	else if (mSmoothedGPUTime < mFrameBudget * kRaiseThreshold && false == isCPUBound)
+	{
+		++mFramesUnderBudget;
+		mFramesOverBudget = 0;
+	}
+	else
+	{	//Inside the band between the thresholds, or waiting on the CPU, this is where it should settle.
+		mFramesOverBudget = 0;
+		mFramesUnderBudget = 0;
+	}
+
+	const float previousScale = mScale;
+	if (mFramesOverBudget >= kFramesBeforeLowering)
+	{
+		mScale = std::max(mMinimumScale, QuantizeScale(mScale - kScaleStep));
+		mFramesOverBudget = 0;
+	}
+	else if (mFramesUnderBudget >= kFramesBeforeRaising)
+	{
+		mScale = std::min(mMaximumScale, QuantizeScale(mScale + kScaleStep));
+		mFramesUnderBudget = 0;
+	}
+
+	if (previousScale != mScale)
+	{	//The smoothed time describes the old resolution, start fresh rather than react to it twice.
+		mSmoothedGPUTime = 0.0f;
+		return true;
+	}
+
+	return false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::DynamicResolution& Asteroids::TheDynamicResolution(void)
+{
+	static DynamicResolution theDynamicResolution;
+	return theDynamicResolution;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::DynamicResolution::DynamicResolution(void) :
+	tbCore::Noncopyable(),
+	mController(),
+	mTargetSize{ 0, 0 },
+	mFrameStart(std::chrono::steady_clock::now()),
+	mQueries(),
+	mIsQueryPending(),
+	mQueryIndex(0),
+	mLastCPUTime(0.0f),
+	mLastGPUTime(0.0f),
+	mIsEnabled(false),
+	mIsTimingGPU(false),
+	mIsQueryActive(false)
+{
+	mQueries.fill(0);
+	mIsQueryPending.fill(false);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::DynamicResolution::~DynamicResolution(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::DynamicResolution::OnCreateGraphicsContext(void)
+{
+	mIsTimingGPU = Implementation::IsTimerQuerySupported();
+	if (true == mIsTimingGPU)
+	{
+		tb_check_gl_errors(glGenQueries(static_cast<GLsizei>(kQueryCount), mQueries.data()));
+	}
+
+	mIsQueryPending.fill(false);
+	mQueryIndex = 0;
+	mIsQueryActive = false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::DynamicResolution::OnDestroyGraphicsContext(void)
+{
+	if (true == mIsTimingGPU)
+	{
+		tb_check_gl_errors(glDeleteQueries(static_cast<GLsizei>(kQueryCount), mQueries.data()));
+	}
+
+	mQueries.fill(0);
+	mIsQueryPending.fill(false);
+	mIsTimingGPU = false;
+	mIsQueryActive = false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::DynamicResolution::BeginFrame(void)
+{
+	mFrameStart = std::chrono::steady_clock::now();
+
+	const UserSettings& settings = TheUserSettings();
+	mIsEnabled = settings.GetBoolean(Settings::DynamicResolution(), true);
+	mController.SetBounds(settings.GetFloat(Settings::DynamicResolutionMinimum(), 0.5f),
+		settings.GetFloat(Settings::DynamicResolutionMaximum(), 1.0f));
+	mController.SetFrameBudget(1000.0f / std::max(1.0f, static_cast<float>(settings.GetInteger(Settings::TargetFrameRate(), 60))));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::DynamicResolution::BeginGPUWork(void)
+{
+	if (false == mIsTimingGPU || true == mIsQueryPending[mQueryIndex])
+	{	//The GPU is more than kQueryCount frames behind, skip timing rather than stall waiting on it.
+		return;
+	}
+
+	tb_check_gl_errors(glBeginQuery(GL_TIME_ELAPSED, mQueries[mQueryIndex]));
+	mIsQueryActive = true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::DynamicResolution::EndGPUWork(void)
+{
+	if (false == mIsQueryActive)
+	{
+		return;
+	}
+
+	tb_check_gl_errors(glEndQuery(GL_TIME_ELAPSED));
+	mIsQueryPending[mQueryIndex] = true;
+	mQueryIndex = (mQueryIndex + 1) % kQueryCount;
+	mIsQueryActive = false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::DynamicResolution::EndFrame(void)
+{
+	const std::chrono::duration<float, std::milli> cpuTime = std::chrono::steady_clock::now() - mFrameStart;
+	mLastCPUTime = cpuTime.count();
+
+	//Oldest first, so the most recent finished result is the one that remains.
+	for (size_t offset = 0; offset < kQueryCount; ++offset)
+	{
+		const size_t queryIndex = (mQueryIndex + offset) % kQueryCount;
+		if (false == mIsQueryPending[queryIndex])
+		{
+			continue;
+		}
+
+		GLint isAvailable = 0;
+		tb_check_gl_errors(glGetQueryObjectiv(mQueries[queryIndex], GL_QUERY_RESULT_AVAILABLE, &isAvailable));
+		if (0 == isAvailable)
+		{
+			break;
+		}
+
+		GLuint64 elapsedNanoseconds = 0;
+		tb_check_gl_errors(glGetQueryObjectui64v(mQueries[queryIndex], GL_QUERY_RESULT, &elapsedNanoseconds));
+		mLastGPUTime = static_cast<float>(elapsedNanoseconds) / 1000000.0f;
+		mIsQueryPending[queryIndex] = false;
+	}
+
+	if (true == mIsEnabled)
+	{
+		// 2026-10-19: The slower of the two used to drive the scale, which cut the resolution of CPU bound frames for
+		//   no gain. Without timer queries the CPU time is all there is, so it stands in for the GPU as before.
+		const float gpuTime = (true == mIsTimingGPU) ? mLastGPUTime : mLastCPUTime;
+		mController.AddFrameTime(gpuTime, mLastCPUTime);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::DynamicResolution::SetTargetSize(const IntVector2& targetSize)
+{
+	mTargetSize = targetSize;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::IntVector2 Asteroids::DynamicResolution::GetTargetSize(void) const
+{
+	if (0 == mTargetSize.x || 0 == mTargetSize.y)
+	{
+		return IntVector2{ static_cast<int>(WorldTargetWidth()), static_cast<int>(WorldTargetHeight()) };
+	}
+
+	return mTargetSize;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::IntVector2 Asteroids::DynamicResolution::GetRenderSize(void) const
+{
+	const float scale = GetScale();
+	const IntVector2 targetSize = GetTargetSize();
+	return IntVector2{
+		std::max(1, static_cast<int>(std::round(static_cast<float>(targetSize.x) * scale))),
+		std::max(1, static_cast<int>(std::round(static_cast<float>(targetSize.y) * scale))),
+	};
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::DynamicResolution::ApplyViewport(void) const
+{
+	const IntVector2 renderSize = GetRenderSize();
+	ShaderSystem::TheGLStateCache().SetViewport(0, 0, renderSize.x, renderSize.y);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class ResolutionControllerTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		ResolutionControllerTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::ResolutionControllerTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using Implementation::ResolutionController;
+
+			ResolutionController controller;
+			controller.SetBounds(0.5f, 1.0f);
+			controller.SetFrameBudget(10.0f);
+
+			//A single slow frame must not change anything.
+			for (int frame = 0; frame < 10; ++frame) { controller.AddFrameTime(5.0f, 2.0f); }
+			controller.AddFrameTime(40.0f, 2.0f);
+			for (int frame = 0; frame < 10; ++frame) { controller.AddFrameTime(5.0f, 2.0f); }
+			ExpectedValue(std::fabs(controller.GetScale() - 1.0f) < 0.001f, true, "Expected a single hitch to leave the scale alone.");
+
+			//Sustained slow frames should walk the scale down to the minimum and no further.
+			for (int frame = 0; frame < 200; ++frame) { controller.AddFrameTime(20.0f, 2.0f); }
+			ExpectedValue(std::fabs(controller.GetScale() - 0.5f) < 0.001f, true, "Expected the scale to stop at the minimum.");
+
+			//Frames inside the hysteresis band should hold the scale where it is.
+			for (int frame = 0; frame < 500; ++frame) { controller.AddFrameTime(8.0f, 2.0f); }
+			ExpectedValue(std::fabs(controller.GetScale() - 0.5f) < 0.001f, true, "Expected the scale to hold inside the band.");
+
+			//Comfortably fast frames raise it again, slowly.
+			for (int frame = 0; frame < ResolutionController::kFramesBeforeRaising + 20; ++frame) { controller.AddFrameTime(3.0f, 2.0f); }
+			ExpectedValue(std::fabs(controller.GetScale() - 0.6f) < 0.001f, true, "Expected one step up after enough fast frames.");
+			for (int frame = 0; frame < 2000; ++frame) { controller.AddFrameTime(3.0f, 2.0f); }
+			ExpectedValue(std::fabs(controller.GetScale() - 1.0f) < 0.001f, true, "Expected the scale to stop at the maximum.");
+
+			//A frame slow on the CPU gains nothing from fewer pixels, the scale must stay put.
+			for (int frame = 0; frame < 200; ++frame) { controller.AddFrameTime(3.0f, 20.0f); }
+			ExpectedValue(std::fabs(controller.GetScale() - 1.0f) < 0.001f, true, "Expected CPU bound frames to leave the scale alone.");
+
+			for (int frame = 0; frame < 200; ++frame) { controller.AddFrameTime(20.0f, 2.0f); }
+			ExpectedValue(std::fabs(controller.GetScale() - 0.5f) < 0.001f, true, "Expected GPU bound frames to lower the scale.");
+
+			//Yet while the CPU is the bottleneck a quick GPU must not walk the scale back up.
+			for (int frame = 0; frame < ResolutionController::kFramesBeforeRaising * 4; ++frame) { controller.AddFrameTime(3.0f, 20.0f); }
+			ExpectedValue(std::fabs(controller.GetScale() - 0.5f) < 0.001f, true, "Expected CPU bound frames to hold the scale down.");
+
+			return true;
+		}
+	};
+
+	ResolutionControllerTest theResolutionControllerTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
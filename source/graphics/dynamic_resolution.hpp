@@ -0,0 +1,132 @@
+///
+/// @file
+/// @details Measures how long each frame takes on the CPU and GPU and lowers or raises the internal resolution of the
+///   world target to keep the frame rate steady during heavy moments.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_DynamicResolution_hpp
+#define Asteroids_DynamicResolution_hpp
+
+#include "../asteroids.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+#include <turtle_brains/core/tb_opengl.hpp>
+
+#include <array>
+#include <chrono>
+
+namespace Asteroids
+{
+
+	namespace Implementation
+	{
+		///
+		/// @details The decision making half of DynamicResolution, kept apart from the timers so it can be tested with
+		///   made up frame times. The scale only moves in kScaleStep increments so the world only ever sees a handful
+		///   of sizes, and it must be over budget (or comfortably under) for several frames in a row before it moves.
+		///
+		class ResolutionController
+		{
+		public:
+			static constexpr float kScaleStep = 0.1f;
+			static constexpr int kFramesBeforeLowering = 8;
+			static constexpr int kFramesBeforeRaising = 90;
+
+			//Lower when above this fraction of the budget, raise when below the other. The gap is the hysteresis.
+			static constexpr float kLowerThreshold = 0.95f;
+			static constexpr float kRaiseThreshold = 0.70f;
+
+			ResolutionController(void);
+
+			void SetBounds(const float minimumScale, const float maximumScale);
+			void SetFrameBudget(const float budgetMilliseconds);
+
+			///
+			/// @details Feeds the GPU and CPU time of one frame and returns true if the scale changed. Only the GPU time
+			///   moves the scale, a lower resolution does nothing for a frame that is slow on the CPU, but the scale will
+			///   not rise while the CPU is the one over budget.
+			///
+			bool AddFrameTime(const float gpuMilliseconds, const float cpuMilliseconds);
+
+			inline float GetScale(void) const { return mScale; }
+			inline float GetSmoothedGPUTime(void) const { return mSmoothedGPUTime; }
+			inline float GetSmoothedCPUTime(void) const { return mSmoothedCPUTime; }
+
+		private:
+			float mMinimumScale;
+			float mMaximumScale;
+			float mFrameBudget;
+			float mScale;
+			float mSmoothedGPUTime;
+			float mSmoothedCPUTime;
+			int mFramesOverBudget;
+			int mFramesUnderBudget;
+		};
+	};
+
+	///
+	/// @details The world target stays allocated at full size and only the viewport shrinks, so changing the scale
+	///   never reallocates anything; OnRender() then stretches just the rendered corner of the target to the window.
+	///
+	class DynamicResolution : public tbCore::Noncopyable
+	{
+	public:
+		DynamicResolution(void);
+		~DynamicResolution(void);
+
+		///
+		/// @details Call at the very start of the frame, before anything is updated, and EndFrame() once the frame has
+		///   been submitted. BeginGPUWork()/EndGPUWork() wrap the rendering into the world target.
+		///
+		void BeginFrame(void);
+		void BeginGPUWork(void);
+		void EndGPUWork(void);
+		void EndFrame(void);
+
+		///
+		/// @details Sets the viewport to the scaled portion of the world target, must be called after each BeginDraw()
+		///   on the world target since that resets the viewport.
+		///
+		void ApplyViewport(void) const;
+
+		///
+		/// @details The size of the world target as allocated, which can lag behind WorldTargetWidth() while a resize
+		///   is being debounced. Defaults to WorldTargetWidth() and WorldTargetHeight() until set.
+		///
+		void SetTargetSize(const IntVector2& targetSize);
+		IntVector2 GetTargetSize(void) const;
+
+		///
+		/// @details The size in pixels of the portion of the world target that is rendered into this frame.
+		///
+		IntVector2 GetRenderSize(void) const;
+		inline float GetScale(void) const { return (true == mIsEnabled) ? mController.GetScale() : 1.0f; }
+		inline float GetLastCPUTime(void) const { return mLastCPUTime; }
+		inline float GetLastGPUTime(void) const { return mLastGPUTime; }
+
+		void OnCreateGraphicsContext(void);
+		void OnDestroyGraphicsContext(void);
+
+	private:
+		static const size_t kQueryCount = 4;
+
+		Implementation::ResolutionController mController;
+		IntVector2 mTargetSize;
+		std::chrono::steady_clock::time_point mFrameStart;
+		std::array<GLuint, kQueryCount> mQueries;
+		std::array<bool, kQueryCount> mIsQueryPending;
+		size_t mQueryIndex;
+		float mLastCPUTime;
+		float mLastGPUTime;
+		bool mIsEnabled;
+		bool mIsTimingGPU;
+		bool mIsQueryActive;
+	};
+
+	DynamicResolution& TheDynamicResolution(void);
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_DynamicResolution_hpp */
@@ -12,7 +12,7 @@
 
 Asteroids::EventBox::EventBox(void) :
 	tbGraphics::GraphicList(),
-	mDarkenBox(1, 1, Color(0x80000000)), //setup in OnUpdate() due to potential ScreenSize changes.
+	mDarkenBox(Vector2(1.0f, 1.0f), Vector2::Zero(), Color(0xAA000000), 0.0f), //sized in OnUpdate() due to potential ScreenSize changes.
 	mBorderBox(Vector2(kEventNoticeSize.x + kBorder * 2, kEventNoticeSize.y + kBorder * 2), Vector2::Zero(), AsteroidsColor::TernaryBackgroundColor, kRoundedCornerRadius, kBorder, AsteroidsColor::TernaryColor),
 	mDarkenBackdrop(false)
 {
@@ -62,7 +62,9 @@ void Asteroids::EventBox::OnUpdate(const float deltaTime)
 	//SetOrigin(Anchor::Center);
 	//SetPosition(Interface::GetAnchorPositionOfInterface(Anchor::Center));
 
-	mDarkenBox = tbGraphics::BoxShape(Interface::TargetWidth(), Interface::TargetHeight(), Color(0xAA000000));
+	// 2026-10-19: This used to assign a brand new BoxShape every update, rebuilding the geometry whether or not the
+	//   interface had changed size. The quad is now only rebuilt when the size is actually different.
+	mDarkenBox.SetShapeSize(Vector2(static_cast<float>(Interface::TargetWidth()), static_cast<float>(Interface::TargetHeight())));
 	mDarkenBox.SetVisible(mDarkenBackdrop);
 	mDarkenBox.SetOrigin(Anchor::Center);
 	mDarkenBox.SetPosition(Interface::GetAnchorPositionOfInterface(Anchor::Center));
@@ -50,7 +50,7 @@ namespace Asteroids
 		virtual void OnRender(void) const override;
 
 	private:
-		tbGraphics::BoxShape mDarkenBox;
+		RoundedBoxShape mDarkenBox;
 		RoundedBoxShape mBorderBox;
 		bool mDarkenBackdrop;
 	};
@@ -0,0 +1,284 @@
+///
+/// @file
+/// @details Renders the fog of wilderness into a reduced resolution target and composites it back into the world with
+///   an edge-aware upsample, since the fog is low frequency and was the most expensive pixel work in the frame.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/fog_of_wilderness_effect.hpp"
+#include "../graphics/dynamic_resolution.hpp"
+#include "../graphics/render_target_pool.hpp"
+#include "../shader_system/gl_state_cache.hpp"
+#include "../shader_system/noise_texture.hpp"
+#include "../user_settings.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+#include <turtle_brains/graphics/tb_sprite.hpp>
+
+// 2025-11-19: Seem to need BeginDraw() to setup and render the RenderTarget view correctly.
+#define TurtleBrains_LetMeHave_Implementation
+#include <turtle_brains/graphics/implementation/tbi_renderer.hpp>
+#undef TurtleBrains_LetMeHave_Implementation
+
+#include <algorithm>
+#include <cmath>
+
+namespace Asteroids::Implementation
+{
+	const float kMinimumFogResolutionScale = 0.25f;
+	const float kMaximumFogResolutionScale = 1.0f;
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Vector2 Asteroids::Implementation::CompositeFogCoordinate(const Vector2& fragmentCoordinate,
+	const Vector2& renderSize, const float targetHeight, const float fullResolutionWidth, const Vector2& fogSize)
+{
+	const Vector2 fragmentPosition(fragmentCoordinate.x, fragmentCoordinate.y - (targetHeight - renderSize.y));
+	const float fullResolutionX = fragmentPosition.x * fullResolutionWidth / renderSize.x;
+	return Vector2(fullResolutionX / std::clamp(fullResolutionWidth, 0.0f, 1920.0f) * fogSize.x,
+		fragmentPosition.y / renderSize.y * fogSize.y);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float Asteroids::FogOfWildernessEffect::GetResolutionScale(void)
+{
+	const float resolutionScale = TheUserSettings().GetFloat(Settings::FogResolutionScale(), 0.5f);
+	return std::clamp(resolutionScale, Implementation::kMinimumFogResolutionScale, Implementation::kMaximumFogResolutionScale);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::FogOfWildernessEffect::FogOfWildernessEffect(void) :
+	tbCore::Noncopyable(),
+	mFogBlock(),
+	mFogTarget(nullptr),
+	mFogTargetSize{ 0, 0 },
+	mFogValues(),
+	mFogColumns(0),
+	mFogRows(0),
+	mTime(0.0f)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::FogOfWildernessEffect::~FogOfWildernessEffect(void)
+{
+	if (nullptr != mFogTarget)
+	{
+		TheRenderTargetPool().Release(*mFogTarget);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::FogOfWildernessEffect::SetFogSize(const size_t columns, const size_t rows)
+{
+	tb_error_if(columns * rows > kMaximumFogCells, "FogOfWilderness can hold at most %d cells.", static_cast<int>(kMaximumFogCells));
+
+	mFogColumns = columns;
+	mFogRows = rows;
+	mFogValues.assign(columns * rows, 1.0f);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::FogOfWildernessEffect::SetFogValue(const size_t column, const size_t row, const float fogValue)
+{
+	tb_error_if(column >= mFogColumns || row >= mFogRows, "FogOfWilderness cell is out of range.");
+	mFogValues[column + row * mFogColumns] = fogValue;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::FogOfWildernessEffect::Update(const float deltaTime)
+{
+	mTime += deltaTime;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::FogOfWildernessEffect::CaptureSnapshot(FogOfWildernessSnapshot& snapshot) const
+{
+	snapshot.mFogValues.assign(mFogValues.begin(), mFogValues.end());
+	snapshot.mFogColumns = mFogColumns;
+	snapshot.mFogRows = mFogRows;
+	snapshot.mTime = mTime;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::FogOfWildernessEffect::Render(const FogOfWildernessSnapshot& snapshot, tbGraphics::RenderTarget& worldTarget) const
+{
+	using namespace ShaderSystem;
+
+	if (true == snapshot.mFogValues.empty())
+	{
+		return;
+	}
+
+	const float resolutionScale = GetResolutionScale();
+	const IntVector2 worldTargetSize = TheDynamicResolution().GetTargetSize();
+	const float worldWidth = static_cast<float>(worldTargetSize.x);
+	const float worldHeight = static_cast<float>(worldTargetSize.y);
+	const IntVector2 fogTargetSize{
+		std::max(1, static_cast<int>(std::round(worldWidth * resolutionScale))),
+		std::max(1, static_cast<int>(std::round(worldHeight * resolutionScale))),
+	};
+
+	if (nullptr == mFogTarget || fogTargetSize.x != mFogTargetSize.x || fogTargetSize.y != mFogTargetSize.y)
+	{
+		if (nullptr != mFogTarget)
+		{
+			TheRenderTargetPool().Release(*mFogTarget);
+		}
+
+		mFogTargetSize = fogTargetSize;
+		mFogTarget = &TheRenderTargetPool().Acquire(fogTargetSize.x, fogTargetSize.y);
+	}
+
+	const Vector2 fogSize(static_cast<float>(snapshot.mFogColumns), static_cast<float>(snapshot.mFogRows));
+	GLStateCache& stateCache = TheGLStateCache();
+
+	//Written once for both passes, the second Bind() reuses the region the first one uploaded the changed rows into.
+	WriteFogBlock(snapshot);
+
+	{	//Fog pass, at the reduced resolution. The world texture is only there to give the sprite its size and UVs, the
+		//fog shader overwrites every channel.
+		mFogTarget->BindRenderTarget();
+		mFogTarget->ClearRenderTarget(ColorPalette::Transparent);
+		tbGraphics::Implementation::Renderer::BeginDraw();
+		stateCache.Invalidate();
+
+		//The fog is written as is into a cleared target, blending it here would apply the alpha twice.
+		stateCache.SetBlendEnabled(false);
+
+		theShaderManager.SetShaderUniform(theFogOfWildernessShader, "uTime", snapshot.mTime);
+		theShaderManager.SetShaderUniform(theFogOfWildernessShader, "uFogSize", fogSize);
+		theShaderManager.SetShaderUniform(theFogOfWildernessShader, "uScreenSize",
+			Vector2(static_cast<float>(fogTargetSize.x), static_cast<float>(fogTargetSize.y)));
+		theShaderManager.SetShaderUniform(theFogOfWildernessShader, "uFullResolutionWidth", worldWidth);
+		BindNoiseTexture();
+
+		theShaderManager.PushAndBindShader(theFogOfWildernessShader);
+		theShaderManager.ApplyUniformsForDraw();
+		mFogBlock.Bind(theFogOfWildernessShader);
+
+		tbGraphics::Sprite fogSprite(worldTarget.GetColorTextureHandle());
+		fogSprite.SetOrigin(Anchor::TopLeft);
+		fogSprite.SetPosition(0.0f, 0.0f);
+		fogSprite.SetScale(fogTargetSize.x / worldWidth, fogTargetSize.y / worldHeight);
+		fogSprite.Render();
+
+		mFogBlock.Unbind();
+		theShaderManager.PopShader();
+
+		stateCache.SetBlendEnabled(true);
+		mFogTarget->UnbindRenderTarget();
+	}
+
+	{	//Composite pass, back into the world at the resolution the world is being rendered at.
+		worldTarget.BindRenderTarget();
+		tbGraphics::Implementation::Renderer::BeginDraw();
+		stateCache.Invalidate();
+		TheDynamicResolution().ApplyViewport();
+
+		const IntVector2 renderSize = TheDynamicResolution().GetRenderSize();
+		theShaderManager.SetShaderUniform(theFogUpsampleShader, "uFogSize", fogSize);
+		theShaderManager.SetShaderUniform(theFogUpsampleShader, "uScreenSize",
+			Vector2(static_cast<float>(renderSize.x), static_cast<float>(renderSize.y)));
+		theShaderManager.SetShaderUniform(theFogUpsampleShader, "uFullResolutionWidth", worldWidth);
+		theShaderManager.SetShaderUniform(theFogUpsampleShader, "uTargetHeight", worldHeight);
+
+		theShaderManager.PushAndBindShader(theFogUpsampleShader);
+		theShaderManager.ApplyUniformsForDraw();
+		mFogBlock.Bind(theFogUpsampleShader);
+
+		tbGraphics::Sprite compositeSprite(mFogTarget->GetColorTextureHandle());
+		compositeSprite.SetOrigin(Anchor::TopLeft);
+		compositeSprite.SetPosition(0.0f, 0.0f);
+		compositeSprite.SetFlippedVertically(true);
+		compositeSprite.SetScale(worldWidth / fogTargetSize.x, worldHeight / fogTargetSize.y);
+		compositeSprite.Render();
+
+		mFogBlock.Unbind();
+		theShaderManager.PopShader();
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::FogOfWildernessEffect::WriteFogBlock(const FogOfWildernessSnapshot& snapshot) const
+{
+	//Every cell is set, but only the rows that differ from the last frame are uploaded.
+	const std::vector<float>& fogValues = snapshot.mFogValues;
+	const auto fogValueOf = [&fogValues](const size_t cellIndex) {
+		return (cellIndex < fogValues.size()) ? fogValues[cellIndex] : 1.0f;
+	};
+
+	ShaderSystem::FogOfWildernessBlock& block = mFogBlock.BeginWrite();
+	for (size_t vectorIndex = 0; vectorIndex < kMaximumFogCells / 4; ++vectorIndex)
+	{
+		ShaderSystem::Std140::Vec4& fogVector = block.mFog[vectorIndex];
+		fogVector.x = fogValueOf(vectorIndex * 4 + 0);
+		fogVector.y = fogValueOf(vectorIndex * 4 + 1);
+		fogVector.z = fogValueOf(vectorIndex * 4 + 2);
+		fogVector.w = fogValueOf(vectorIndex * 4 + 3);
+	}
+	mFogBlock.EndWrite();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class FogCompositeCoordinateTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		FogCompositeCoordinateTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::FogCompositeCoordinateTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using Implementation::CompositeFogCoordinate;
+
+			const Vector2 fogSize(16.0f, 9.0f);
+			const float targetWidth = 1920.0f;
+			const float targetHeight = 1080.0f;
+
+			for (const float scale : { 1.0f, 0.5f })
+			{
+				const Vector2 renderSize(targetWidth * scale, targetHeight * scale);
+				const float firstRow = targetHeight - renderSize.y + 0.5f;
+				const float lastRow = targetHeight - 0.5f;
+
+				const Vector2 topLeft = CompositeFogCoordinate(Vector2(0.5f, firstRow), renderSize, targetHeight, targetWidth, fogSize);
+				const Vector2 bottomRight = CompositeFogCoordinate(Vector2(renderSize.x - 0.5f, lastRow), renderSize, targetHeight, targetWidth, fogSize);
+				const Vector2 middle = CompositeFogCoordinate(Vector2(renderSize.x * 0.5f, firstRow - 0.5f + renderSize.y * 0.5f),
+					renderSize, targetHeight, targetWidth, fogSize);
+
+				ExpectedValue(topLeft.x < 0.1f && topLeft.y < 0.1f, true, "Expected the top-left fragment in the first fog cell.");
+				ExpectedValue(bottomRight.x > 15.9f && bottomRight.x < 16.0f, true, "Expected the right edge in the last fog column.");
+				ExpectedValue(bottomRight.y > 8.9f && bottomRight.y < 9.0f, true, "Expected the bottom edge in the last fog row.");
+				ExpectedValue(std::fabs(middle.x - 8.0f) < 0.01f && std::fabs(middle.y - 4.5f) < 0.01f, true,
+					"Expected the centre of the pass at the centre of the fog.");
+			}
+
+			return true;
+		}
+	};
+
+	FogCompositeCoordinateTest theFogCompositeCoordinateTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,94 @@
+///
+/// @file
+/// @details Renders the fog of wilderness into a reduced resolution target and composites it back into the world with
+///   an edge-aware upsample, since the fog is low frequency and was the most expensive pixel work in the frame.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_FogOfWildernessEffect_hpp
+#define Asteroids_FogOfWildernessEffect_hpp
+
+#include "../asteroids.hpp"
+#include "../shader_system/shaders.hpp"
+#include "../shader_system/uniform_buffer.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+#include <turtle_brains/graphics/tb_render_target.hpp>
+
+#include <vector>
+
+namespace Asteroids
+{
+
+	///
+	/// @details Everything the fog needs to render a frame, copied out of the effect during the snapshot stage.
+	///
+	struct FogOfWildernessSnapshot
+	{
+		std::vector<float> mFogValues;
+		size_t mFogColumns = 0;
+		size_t mFogRows = 0;
+		float mTime = 0.0f;
+	};
+
+	namespace Implementation
+	{
+		///
+		/// @details CPU version of the fog cell lookup in fog_upsample_gl3_2.frag for a gl_FragCoord, with the origin
+		///   at the top, of the composite pass drawn into the bottom renderSize.y rows of the world target.
+		///
+		Vector2 CompositeFogCoordinate(const Vector2& fragmentCoordinate, const Vector2& renderSize,
+			const float targetHeight, const float fullResolutionWidth, const Vector2& fogSize);
+	};
+
+	class FogOfWildernessEffect : public tbCore::Noncopyable
+	{
+	public:
+		//The ubFogOfWilderness block holds one float per cell, packed four to a vec4.
+		static const size_t kMaximumFogCells = 512 * 4;
+
+		///
+		/// @details Returns Settings::FogResolutionScale() clamped to a sensible range, 0.5 renders the fog at half the
+		///   width and height of the world target which is a quarter of the pixels.
+		///
+		static float GetResolutionScale(void);
+
+		FogOfWildernessEffect(void);
+		~FogOfWildernessEffect(void);
+
+		///
+		/// @details Resizes the grid of fog cells that stretches over the world, every cell is reset to fully fogged.
+		///
+		void SetFogSize(const size_t columns, const size_t rows);
+		void SetFogValue(const size_t column, const size_t row, const float fogValue);
+
+		void Update(const float deltaTime);
+		void CaptureSnapshot(FogOfWildernessSnapshot& snapshot) const;
+
+		///
+		/// @details Expects the world target to be bound and leaves it bound again afterwards, ready to keep drawing.
+		///   Only the snapshot is read for the fog itself, the effect holds the GPU resources.
+		///
+		void Render(const FogOfWildernessSnapshot& snapshot, tbGraphics::RenderTarget& worldTarget) const;
+
+		///
+		/// @details The size of the reduced resolution target after the most recent Render(), for diagnostics.
+		///
+		inline IntVector2 GetFogTargetSize(void) const { return mFogTargetSize; }
+
+	private:
+		void WriteFogBlock(const FogOfWildernessSnapshot& snapshot) const;
+
+		mutable ShaderSystem::UniformBlock<ShaderSystem::FogOfWildernessBlock> mFogBlock;
+		mutable tbGraphics::RenderTarget* mFogTarget; //Owned by TheRenderTargetPool()
+		mutable IntVector2 mFogTargetSize;
+		std::vector<float> mFogValues;
+		size_t mFogColumns;
+		size_t mFogRows;
+		float mTime;
+	};
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_FogOfWildernessEffect_hpp */
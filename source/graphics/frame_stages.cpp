@@ -0,0 +1,166 @@
+///
+/// @file
+/// @details Splits each frame into the stages it moves through, simulate and update to change the game, snapshot to
+///   gather what the render needs and render to submit it, and keeps the time spent in each.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/frame_stages.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <cmath>
+
+namespace Asteroids::Implementation
+{
+	//How much of each new frame goes into the smoothed stage times, the same weight DynamicResolution uses.
+	const float kStageTimeSmoothing = 0.1f;
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::FrameStageTimer& Asteroids::TheFrameStages(void)
+{
+	static FrameStageTimer theFrameStages;
+	return theFrameStages;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const char* Asteroids::FrameStageTimer::GetStageName(const FrameStage stage)
+{
+	switch (stage)
+	{
+	case FrameStage::Simulate: return "simulate";
+	case FrameStage::Update: return "update";
+	case FrameStage::Snapshot: return "snapshot";
+	case FrameStage::Render: return "render";
+	case FrameStage::Present: return "present";
+	case FrameStage::NumberOfStages: break;
+	};
+
+	return "unknown";
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::FrameStageTimer::FrameStageTimer(void) :
+	tbCore::Noncopyable(),
+	mStageStart(std::chrono::steady_clock::now()),
+	mFrameTimes(),
+	mLastFrameTimes(),
+	mSmoothedTimes(),
+	mCurrentStage(FrameStage::Present),
+	mFrameNumber(0)
+{
+	mFrameTimes.fill(0.0f);
+	mLastFrameTimes.fill(0.0f);
+	mSmoothedTimes.fill(0.0f);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::FrameStageTimer::~FrameStageTimer(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::FrameStageTimer::EnterStage(const FrameStage stage)
+{
+	tb_error_if(FrameStage::NumberOfStages == stage, "Expected a real FrameStage to enter.");
+
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	AddStageTime(mCurrentStage, std::chrono::duration<float, std::milli>(now - mStageStart).count());
+	mStageStart = now;
+	mCurrentStage = stage;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::FrameStageTimer::AddStageTime(const FrameStage stage, const float milliseconds)
+{
+	mFrameTimes[static_cast<size_t>(stage)] += milliseconds;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::FrameStageTimer::EndFrame(void)
+{
+	EnterStage(FrameStage::Present);
+
+	for (size_t stageIndex = 0; stageIndex < kNumberOfStages; ++stageIndex)
+	{
+		const float stageTime = mFrameTimes[stageIndex];
+		mSmoothedTimes[stageIndex] = (0 == mFrameNumber) ? stageTime :
+			mSmoothedTimes[stageIndex] + (stageTime - mSmoothedTimes[stageIndex]) * Implementation::kStageTimeSmoothing;
+	}
+
+	mLastFrameTimes = mFrameTimes;
+	mFrameTimes.fill(0.0f);
+	++mFrameNumber;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float Asteroids::FrameStageTimer::GetLastStageTime(const FrameStage stage) const
+{
+	return mLastFrameTimes[static_cast<size_t>(stage)];
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float Asteroids::FrameStageTimer::GetSmoothedStageTime(const FrameStage stage) const
+{
+	return mSmoothedTimes[static_cast<size_t>(stage)];
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class FrameStageTimerTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		FrameStageTimerTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::FrameStageTimerTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			FrameStageTimer stages;
+
+			//Simulate runs once per fixed step, several steps in one frame should add together.
+			stages.AddStageTime(FrameStage::Simulate, 2.0f);
+			stages.AddStageTime(FrameStage::Simulate, 2.0f);
+			stages.AddStageTime(FrameStage::Render, 3.0f);
+			ExpectedValue(stages.GetLastStageTime(FrameStage::Simulate) < 0.001f, true, "Expected nothing until the frame ends.");
+
+			stages.EndFrame();
+			ExpectedValue(stages.GetFrameNumber(), size_t(1), "Expected EndFrame() to count the frame.");
+			ExpectedValue(std::fabs(stages.GetLastStageTime(FrameStage::Simulate) - 4.0f) < 0.001f, true, "Expected simulate steps to add up.");
+			ExpectedValue(std::fabs(stages.GetLastStageTime(FrameStage::Render) - 3.0f) < 0.001f, true, "Expected the render time to be kept.");
+			ExpectedValue(std::fabs(stages.GetSmoothedStageTime(FrameStage::Render) - 3.0f) < 0.001f, true, "Expected the first frame to seed the smoothed time.");
+			ExpectedValue(true == (FrameStage::Present == stages.GetCurrentStage()), true, "Expected EndFrame() to enter Present.");
+
+			//The next frame starts from zero and the smoothed time only moves part of the way.
+			stages.AddStageTime(FrameStage::Render, 13.0f);
+			stages.EndFrame();
+			ExpectedValue(stages.GetLastStageTime(FrameStage::Simulate) < 0.001f, true, "Expected each frame to start from zero.");
+			ExpectedValue(std::fabs(stages.GetSmoothedStageTime(FrameStage::Render) - 4.0f) < 0.001f, true, "Expected the smoothed time to lag a spike.");
+
+			return true;
+		}
+	};
+
+	FrameStageTimerTest theFrameStageTimerTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,72 @@
+///
+/// @file
+/// @details Splits each frame into the stages it moves through, simulate and update to change the game, snapshot to
+///   gather what the render needs and render to submit it, and keeps the time spent in each.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_FrameStages_hpp
+#define Asteroids_FrameStages_hpp
+
+#include "../asteroids.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+
+#include <array>
+#include <chrono>
+
+namespace Asteroids
+{
+
+	///
+	/// @details Present is everything outside of the scene; swapping buffers, waiting on vsync and pumping events. It
+	///   begins at EndFrame() so it is charged to the frame that follows.
+	///
+	enum class FrameStage : tbCore::uint8 { Simulate, Update, Snapshot, Render, Present, NumberOfStages };
+
+	class FrameStageTimer : public tbCore::Noncopyable
+	{
+	public:
+		static const size_t kNumberOfStages = static_cast<size_t>(FrameStage::NumberOfStages);
+
+		static const char* GetStageName(const FrameStage stage);
+
+		FrameStageTimer(void);
+		~FrameStageTimer(void);
+
+		///
+		/// @details Charges the time since the last call to the stage that was current and makes this one current. A
+		///   stage can be entered many times a frame, Simulate is entered for each fixed step, and the times add up.
+		///
+		void EnterStage(const FrameStage stage);
+
+		///
+		/// @details Adds time to a stage without touching the clock, used by EnterStage() and by the tests.
+		///
+		void AddStageTime(const FrameStage stage, const float milliseconds);
+
+		///
+		/// @details Closes the frame, the stage times become the last frame times, and enters the Present stage.
+		///
+		void EndFrame(void);
+
+		inline FrameStage GetCurrentStage(void) const { return mCurrentStage; }
+		inline size_t GetFrameNumber(void) const { return mFrameNumber; }
+		float GetLastStageTime(const FrameStage stage) const;
+		float GetSmoothedStageTime(const FrameStage stage) const;
+
+	private:
+		std::chrono::steady_clock::time_point mStageStart;
+		std::array<float, kNumberOfStages> mFrameTimes;
+		std::array<float, kNumberOfStages> mLastFrameTimes;
+		std::array<float, kNumberOfStages> mSmoothedTimes;
+		FrameStage mCurrentStage;
+		size_t mFrameNumber;
+	};
+
+	FrameStageTimer& TheFrameStages(void);
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_FrameStages_hpp */
@@ -0,0 +1,80 @@
+///
+/// @file
+/// @details Holds one graphic for each distinct thing the world draws, an asteroid of each size, the rocket ship and
+///   the laser, so a render snapshot can name what to draw with a number instead of pointing into an entity.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/mesh_library.hpp"
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::MeshLibrary& Asteroids::TheMeshLibrary(void)
+{
+	static MeshLibrary theMeshLibrary;
+	return theMeshLibrary;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::MeshLibrary::MeshLibrary(void) :
+	tbCore::Noncopyable(),
+	mMeshes()
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::MeshLibrary::~MeshLibrary(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::MeshLibrary::AddMesh(const MeshId meshId, std::unique_ptr<tbGraphics::Graphic>&& graphic,
+	const MeshState& meshState)
+{
+	tb_error_if(nullptr == graphic, "MeshLibrary expected a graphic for mesh 0x%08X.", meshId);
+	tb_error_if(true == HasMesh(meshId), "MeshLibrary already has a mesh with id 0x%08X.", meshId);
+	tb_error_if(mMeshes.size() >= 0xFFFF, "MeshLibrary has run out of mesh keys.");
+
+	//Keys start at 1, leaving 0 for meshes that are missing.
+	const tbCore::uint16 meshKey = static_cast<tbCore::uint16>(mMeshes.size() + 1);
+	mMeshes.emplace(meshId, MeshEntry{ std::move(graphic), meshState, meshKey });
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbGraphics::Graphic* Asteroids::MeshLibrary::FindMesh(const MeshId meshId)
+{
+	const auto meshIterator = mMeshes.find(meshId);
+	return (mMeshes.end() == meshIterator) ? nullptr : meshIterator->second.mGraphic.get();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const Asteroids::MeshState& Asteroids::MeshLibrary::GetMeshState(const MeshId meshId) const
+{
+	static const MeshState kUnknownMeshState;
+
+	const auto meshIterator = mMeshes.find(meshId);
+	return (mMeshes.end() == meshIterator) ? kUnknownMeshState : meshIterator->second.mState;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint16 Asteroids::MeshLibrary::GetMeshKey(const MeshId meshId) const
+{
+	const auto meshIterator = mMeshes.find(meshId);
+	return (mMeshes.end() == meshIterator) ? 0 : meshIterator->second.mMeshKey;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::MeshLibrary::DestroyAll(void)
+{
+	mMeshes.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
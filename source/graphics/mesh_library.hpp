@@ -0,0 +1,100 @@
+///
+/// @file
+/// @details Holds one graphic for each distinct thing the world draws, an asteroid of each size, the rocket ship and
+///   the laser, so a render snapshot can name what to draw with a number instead of pointing into an entity.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_MeshLibrary_hpp
+#define Asteroids_MeshLibrary_hpp
+
+#include "../asteroids.hpp"
+#include "../graphics/render_layer.hpp"
+#include "../shader_system/shader_manager.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+#include <turtle_brains/graphics/tb_graphic.hpp>
+
+#include <memory>
+#include <unordered_map>
+
+namespace Asteroids
+{
+
+	enum class MeshKind : tbCore::uint8 { Asteroid, RocketShip, Laser };
+
+	///
+	/// @details | kind (8) | variant (24) |, the variant picks between meshes of the same kind, like asteroid size.
+	///
+	using MeshId = tbCore::uint32;
+
+	constexpr MeshId MakeMeshId(const MeshKind kind, const tbCore::uint32 variant = 0)
+	{
+		return (static_cast<MeshId>(kind) << 24) | (variant & 0x00FFFFFF);
+	}
+
+	///
+	/// @details The state a mesh needs to be drawn, which the snapshot renderer sorts by. The shader is the one the
+	///   renderer binds before drawing, or InvalidShader() for graphics drawn with the TurtleBrains shader, and the
+	///   texture key is 0 for shapes or MakeTextureKey() of the file the graphic draws.
+	///
+	struct MeshState
+	{
+		BlendMode mBlend = BlendMode::Opaque;
+		ShaderSystem::ShaderHandle mShader = ShaderSystem::InvalidShader();
+		tbCore::uint16 mTextureKey = 0;
+	};
+
+	class MeshLibrary : public tbCore::Noncopyable
+	{
+	public:
+		MeshLibrary(void);
+		~MeshLibrary(void);
+
+		inline bool HasMesh(const MeshId meshId) const { return mMeshes.end() != mMeshes.find(meshId); }
+
+		///
+		/// @details The library takes ownership of the graphic, each mesh id can only be added once. Meshes are kept
+		///   until DestroyAll() so the handful of prototypes are created once and shared by every entity.
+		///
+		void AddMesh(const MeshId meshId, std::unique_ptr<tbGraphics::Graphic>&& graphic,
+			const MeshState& meshState = MeshState());
+
+		///
+		/// @details The renderer moves, turns and tints the prototype for each object it draws, so this is not const.
+		///   Returns nullptr for an unknown mesh.
+		///
+		tbGraphics::Graphic* FindMesh(const MeshId meshId);
+
+		///
+		/// @details Returns the default MeshState for an unknown mesh so it still sorts somewhere sensible.
+		///
+		const MeshState& GetMeshState(const MeshId meshId) const;
+
+		///
+		/// @details A small number, unique for each mesh in the library, that stands in for the mesh in a sort key
+		///   where the 32-bit MeshId does not fit. Returns 0 for an unknown mesh.
+		///
+		tbCore::uint16 GetMeshKey(const MeshId meshId) const;
+
+		void DestroyAll(void);
+
+		inline size_t GetMeshCount(void) const { return mMeshes.size(); }
+
+	private:
+		struct MeshEntry
+		{
+			std::unique_ptr<tbGraphics::Graphic> mGraphic;
+			MeshState mState;
+			tbCore::uint16 mMeshKey;
+		};
+
+		std::unordered_map<MeshId, MeshEntry> mMeshes;
+	};
+
+	MeshLibrary& TheMeshLibrary(void);
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_MeshLibrary_hpp */
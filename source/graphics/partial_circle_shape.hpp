@@ -1,40 +1,40 @@
 ///
 /// @file
-/// @details Displays a half circle.
+/// @details Displays a circle, or part of a ring, like a progress indicator.
 ///
 /// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
 ///------------------------------------------------------------------------------------------------------------------///
 
-#ifndef Asteroids_ParialCircleShape_hpp
-#define Asteroids_ParialCircleShape_hpp
+#ifndef Asteroids_PartialCircleShape_hpp
+#define Asteroids_PartialCircleShape_hpp
 
-#include <turtle_brains/graphics/tb_graphic.hpp>
-#include <turtle_brains/graphics/tb_basic_shapes.hpp>
-#include <turtle_brains/graphics/tb_sprite.hpp>
+#include "../graphics/sdf_shape.hpp"
 
 namespace Asteroids
 {
 
-	class PartialCircleShape : public tbGraphics::PolygonShape
+	///
+	/// @details A ring of the given thickness from the start angle to the end angle, clockwise on screen from the
+	///   right. A thickness equal to the radius fills the circle. Changing the angles is cheap, the shape is never
+	///   rebuilt, so an animated progress ring can set them every frame.
+	///
+	class PartialCircleShape : public SdfShape
 	{
 	public:
 		PartialCircleShape(const float radius = 64.0f, const tbGraphics::Color& color = tbGraphics::ColorPalette::White,
-			const tbMath::Vector2& position = tbMath::Vector2::Zero(), const int sectionCount = 30,
-			const float startAngleRadians = 0.0f, const float endAngleRadians = tbMath::kTwoPi,
-			const float thickness = 1.0f);
+			const tbMath::Vector2& position = tbMath::Vector2::Zero(), const float startAngleRadians = 0.0f,
+			const float endAngleRadians = tbMath::kTwoPi, const float thickness = 1.0f, const float border = 0.0f,
+			const tbGraphics::Color& borderColor = tbGraphics::ColorPalette::White);
 		virtual ~PartialCircleShape(void);
 
-		inline virtual tbGraphics::PixelSpace GetPixelWidth(void) const override { return static_cast<tbGraphics::PixelSpace>(mRadius * 2); }
-		inline virtual tbGraphics::PixelSpace GetPixelHeight(void) const override { return static_cast<tbGraphics::PixelSpace>(mRadius * 2); }
+		inline float GetRadius(void) const { return mArc.w; }
+
+		void SetAngles(const float startAngleRadians, const float endAngleRadians);
 
 	protected:
 		virtual void OnUpdate(const float deltaTime) override;
-		virtual void OnRender(void) const override;
-
-	private:
-		float mRadius;
 	};
 
 };	//namespace Asteroids
 
-#endif /* Asteroids_ParialCircleShape_hpp */
+#endif /* Asteroids_PartialCircleShape_hpp */
@@ -0,0 +1,610 @@
+///
+/// @file
+/// @details A particle system for the small, short lived effects like asteroid debris and bullet impacts that would be
+///   far too many entities. Particles are kept as flat arrays, updated four at a time and streamed to the GPU as
+///   points with one draw for each blend mode.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/particle_system.hpp"
+#include "../graphics/dynamic_resolution.hpp"
+#include "../shader_system/gl_state_cache.hpp"
+#include "../shader_system/shaders.hpp"
+#include "../shader_system/uniform_buffer.hpp"
+#include "../user_settings.hpp"
+
+// 2025-11-19: The ShaderSystem Implementation depends on the TurtleBrains renderer, for check_gl_errors and other
+//   implementation details. We 'know what we are doing'.
+#define TurtleBrains_LetMeHave_Implementation
+#include <turtle_brains/graphics/implementation/tbi_renderer.hpp>
+#undef TurtleBrains_LetMeHave_Implementation
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(asteroids_particles_with_sse2)
+  #include <emmintrin.h>
+#endif /* asteroids_particles_with_sse2 */
+
+namespace Asteroids::Implementation
+{
+	const std::array<float, 3> kParticleQualityScale = { 0.25f, 0.5f, 1.0f };
+
+	inline size_t RoundUpToFour(const size_t value)
+	{
+		return (value + 3) & ~static_cast<size_t>(3);
+	}
+
+	inline float ColorChannel(const tbCore::uint32 color, const int shift)
+	{
+		return static_cast<float>((color >> shift) & 0xFF) / 255.0f;
+	}
+
+	//Red, green, blue and alpha from 0xAARRGGBB.
+	inline std::array<float, 4> UnpackColor(const tbCore::uint32 color)
+	{
+		return { ColorChannel(color, 16), ColorChannel(color, 8), ColorChannel(color, 0), ColorChannel(color, 24) };
+	}
+
+	inline tbCore::uint32 ToChannelByte(const float value)
+	{
+		return static_cast<tbCore::uint32>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ParticleQuality Asteroids::GetParticleQuality(void)
+{
+	const tbCore::int64 quality = TheUserSettings().GetInteger(Settings::ParticleQuality(), static_cast<tbCore::int64>(ParticleQuality::High));
+	return static_cast<ParticleQuality>(std::clamp<tbCore::int64>(quality, 0, 2));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ParticlePool::ParticlePool(const size_t capacity) :
+	mCount(0),
+	mCapacity(Implementation::RoundUpToFour(capacity)),
+	mPositionX(mCapacity, 0.0f),
+	mPositionY(mCapacity, 0.0f),
+	mVelocityX(mCapacity, 0.0f),
+	mVelocityY(mCapacity, 0.0f),
+	mAge(mCapacity, 0.0f),
+	mInverseLifetime(mCapacity, 0.0f),
+	mDrag(mCapacity, 0.0f),
+	mSizeStart(mCapacity, 0.0f),
+	mSizeDelta(mCapacity, 0.0f),
+	mColorStart{ std::vector<float>(mCapacity, 0.0f), std::vector<float>(mCapacity, 0.0f),
+		std::vector<float>(mCapacity, 0.0f), std::vector<float>(mCapacity, 0.0f) },
+	mColorDelta{ std::vector<float>(mCapacity, 0.0f), std::vector<float>(mCapacity, 0.0f),
+		std::vector<float>(mCapacity, 0.0f), std::vector<float>(mCapacity, 0.0f) },
+	mSize(mCapacity, 0.0f),
+	mColor(mCapacity, 0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ParticlePool::MoveParticle(const size_t fromIndex, const size_t toIndex)
+{
+	mPositionX[toIndex] = mPositionX[fromIndex];
+	mPositionY[toIndex] = mPositionY[fromIndex];
+	mVelocityX[toIndex] = mVelocityX[fromIndex];
+	mVelocityY[toIndex] = mVelocityY[fromIndex];
+	mAge[toIndex] = mAge[fromIndex];
+	mInverseLifetime[toIndex] = mInverseLifetime[fromIndex];
+	mDrag[toIndex] = mDrag[fromIndex];
+	mSizeStart[toIndex] = mSizeStart[fromIndex];
+	mSizeDelta[toIndex] = mSizeDelta[fromIndex];
+	for (size_t channel = 0; channel < 4; ++channel)
+	{
+		mColorStart[channel][toIndex] = mColorStart[channel][fromIndex];
+		mColorDelta[channel][toIndex] = mColorDelta[channel][fromIndex];
+	}
+	mSize[toIndex] = mSize[fromIndex];
+	mColor[toIndex] = mColor[fromIndex];
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Implementation::UpdateParticleRange(ParticlePool& pool, const size_t beginIndex, const size_t endIndex,
+	const float deltaTime)
+{
+	for (size_t index = beginIndex; index < endIndex; ++index)
+	{
+		pool.mAge[index] += deltaTime;
+		const float life = std::min(pool.mAge[index] * pool.mInverseLifetime[index], 1.0f);
+
+		const float dragScale = std::max(1.0f - pool.mDrag[index] * deltaTime, 0.0f);
+		pool.mVelocityX[index] *= dragScale;
+		pool.mVelocityY[index] *= dragScale;
+		pool.mPositionX[index] += pool.mVelocityX[index] * deltaTime;
+		pool.mPositionY[index] += pool.mVelocityY[index] * deltaTime;
+
+		pool.mSize[index] = pool.mSizeStart[index] + pool.mSizeDelta[index] * life;
+
+		tbCore::uint32 color = 0;
+		for (size_t channel = 0; channel < 4; ++channel)
+		{
+			const float value = pool.mColorStart[channel][index] + pool.mColorDelta[channel][index] * life;
+			color |= ToChannelByte(value) << (channel * 8);
+		}
+		pool.mColor[index] = color;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Implementation::UpdateParticles(ParticlePool& pool, const float deltaTime)
+{
+	const size_t updateCount = RoundUpToFour(pool.mCount);
+
+#if defined(asteroids_particles_with_sse2)
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 byteScale = _mm_set1_ps(255.0f);
+	const __m128 delta = _mm_set1_ps(deltaTime);
+
+	for (size_t index = 0; index < updateCount; index += 4)
+	{
+		const __m128 age = _mm_add_ps(_mm_loadu_ps(&pool.mAge[index]), delta);
+		_mm_storeu_ps(&pool.mAge[index], age);
+		const __m128 life = _mm_min_ps(_mm_mul_ps(age, _mm_loadu_ps(&pool.mInverseLifetime[index])), one);
+
+		const __m128 dragScale = _mm_max_ps(_mm_sub_ps(one, _mm_mul_ps(_mm_loadu_ps(&pool.mDrag[index]), delta)), zero);
+		const __m128 velocityX = _mm_mul_ps(_mm_loadu_ps(&pool.mVelocityX[index]), dragScale);
+		const __m128 velocityY = _mm_mul_ps(_mm_loadu_ps(&pool.mVelocityY[index]), dragScale);
+		_mm_storeu_ps(&pool.mVelocityX[index], velocityX);
+		_mm_storeu_ps(&pool.mVelocityY[index], velocityY);
+		_mm_storeu_ps(&pool.mPositionX[index], _mm_add_ps(_mm_loadu_ps(&pool.mPositionX[index]), _mm_mul_ps(velocityX, delta)));
+		_mm_storeu_ps(&pool.mPositionY[index], _mm_add_ps(_mm_loadu_ps(&pool.mPositionY[index]), _mm_mul_ps(velocityY, delta)));
+
+		_mm_storeu_ps(&pool.mSize[index], _mm_add_ps(_mm_loadu_ps(&pool.mSizeStart[index]),
+			_mm_mul_ps(_mm_loadu_ps(&pool.mSizeDelta[index]), life)));
+
+		//Each channel is clamped, scaled to a byte and rounded exactly as ToChannelByte() does, then shifted into place.
+		__m128i color = _mm_setzero_si128();
+		for (int channel = 0; channel < 4; ++channel)
+		{
+			__m128 value = _mm_add_ps(_mm_loadu_ps(&pool.mColorStart[channel][index]),
+				_mm_mul_ps(_mm_loadu_ps(&pool.mColorDelta[channel][index]), life));
+			value = _mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(value, zero), one), byteScale), half);
+
+			__m128i channelBytes = _mm_cvttps_epi32(value);
+			switch (channel)
+			{
+			case 1: channelBytes = _mm_slli_epi32(channelBytes, 8); break;
+			case 2: channelBytes = _mm_slli_epi32(channelBytes, 16); break;
+			case 3: channelBytes = _mm_slli_epi32(channelBytes, 24); break;
+			default: break;
+			}
+			color = _mm_or_si128(color, channelBytes);
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&pool.mColor[index]), color);
+	}
+#else
+	UpdateParticleRange(pool, 0, updateCount, deltaTime);
+#endif /* asteroids_particles_with_sse2 */
+
+	//Walking backwards, the particle swapped in from the end has always been checked already.
+	for (size_t index = pool.mCount; index > 0; --index)
+	{
+		const size_t particleIndex = index - 1;
+		if (pool.mAge[particleIndex] * pool.mInverseLifetime[particleIndex] >= 1.0f)
+		{
+			--pool.mCount;
+			if (particleIndex != pool.mCount)
+			{
+				pool.MoveParticle(pool.mCount, particleIndex);
+			}
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ParticleSystem& Asteroids::TheParticleSystem(void)
+{
+	static ParticleSystem theParticleSystem;
+	return theParticleSystem;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::ParticleSystem::PoolIndexOf(const BlendMode blendMode)
+{
+	tb_error_if(BlendMode::Opaque == blendMode, "Particles must be alpha or additive blended.");
+	return (BlendMode::Additive == blendMode) ? 1 : 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ParticleSystem::ParticleSystem(void) :
+	tbCore::Noncopyable(),
+	mPools{ ParticlePool(kMaximumParticles), ParticlePool(kMaximumParticles) },
+	mPoolBuffers(),
+	mQuality(ParticleQuality::High),
+	mFrameStats(),
+	mLastFrameStats()
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ParticleSystem::~ParticleSystem(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ParticleSystem::Emit(const ParticleEffect& effect, const Vector2& position, const Vector2& direction,
+	const Vector2& inheritedVelocity)
+{
+	const float qualityScale = Implementation::kParticleQualityScale[static_cast<size_t>(mQuality)];
+	const size_t budget = GetParticleBudget();
+	const size_t requestedCount = std::max<size_t>(1, static_cast<size_t>(static_cast<float>(effect.mCount) * qualityScale));
+	const size_t available = budget - std::min(budget, GetParticleCount());
+	const size_t emitCount = std::min(requestedCount, available);
+
+	mFrameStats.mParticlesEmitted += emitCount;
+	mFrameStats.mParticlesDropped += requestedCount - emitCount;
+
+	ParticlePool& pool = mPools[PoolIndexOf(effect.mBlendMode)];
+	const std::array<float, 4> startColor = Implementation::UnpackColor(effect.mStartColor);
+	const std::array<float, 4> endColor = Implementation::UnpackColor(effect.mEndColor);
+	const float baseAngle = std::atan2(direction.y, direction.x);
+
+	for (size_t emitIndex = 0; emitIndex < emitCount && pool.mCount < pool.mCapacity; ++emitIndex)
+	{
+		const size_t index = pool.mCount++;
+		const float angle = baseAngle + tbMath::RandomFloat(-0.5f, 0.5f) * effect.mSpread;
+		const float speed = tbMath::RandomFloat(effect.mMinimumSpeed, effect.mMaximumSpeed);
+		const float lifetime = std::max(tbMath::RandomFloat(effect.mMinimumLifetime, effect.mMaximumLifetime), 0.01f);
+
+		pool.mPositionX[index] = position.x;
+		pool.mPositionY[index] = position.y;
+		pool.mVelocityX[index] = std::cos(angle) * speed + inheritedVelocity.x;
+		pool.mVelocityY[index] = std::sin(angle) * speed + inheritedVelocity.y;
+		pool.mAge[index] = 0.0f;
+		pool.mInverseLifetime[index] = 1.0f / lifetime;
+		pool.mDrag[index] = effect.mDrag;
+		pool.mSizeStart[index] = effect.mStartSize;
+		pool.mSizeDelta[index] = effect.mEndSize - effect.mStartSize;
+		for (size_t channel = 0; channel < 4; ++channel)
+		{
+			pool.mColorStart[channel][index] = startColor[channel];
+			pool.mColorDelta[channel][index] = endColor[channel] - startColor[channel];
+		}
+
+		//Drawable before the first update.
+		Implementation::UpdateParticleRange(pool, index, index + 1, 0.0f);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ParticleSystem::Update(const float deltaTime)
+{
+	const auto updateStart = std::chrono::steady_clock::now();
+
+	for (ParticlePool& pool : mPools)
+	{
+		Implementation::UpdateParticles(pool, deltaTime);
+	}
+
+	mFrameStats.mParticlesAlive = GetParticleCount();
+	mFrameStats.mUpdateTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+	mFrameStats.mDrawCalls = mLastFrameStats.mDrawCalls;
+	mLastFrameStats = mFrameStats;
+	mFrameStats = FrameStats();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ParticleSystem::Clear(void)
+{
+	for (ParticlePool& pool : mPools)
+	{
+		pool.mCount = 0;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::ParticleSystem::GetParticleCount(void) const
+{
+	size_t particleCount = 0;
+	for (const ParticlePool& pool : mPools)
+	{
+		particleCount += pool.mCount;
+	}
+	return particleCount;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::ParticleSystem::GetParticleBudget(void) const
+{
+	const float qualityScale = Implementation::kParticleQualityScale[static_cast<size_t>(mQuality)];
+	return static_cast<size_t>(static_cast<float>(kMaximumParticles) * qualityScale);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ParticleSystem::Render(void) const
+{
+	using namespace ShaderSystem;
+
+	mLastFrameStats.mDrawCalls = 0;
+	if (0 == GetParticleCount())
+	{
+		return;
+	}
+
+	const IntVector2 targetSize = TheDynamicResolution().GetTargetSize();
+	const IntVector2 renderSize = TheDynamicResolution().GetRenderSize();
+	const float worldWidth = static_cast<float>(targetSize.x);
+	const float worldHeight = static_cast<float>(targetSize.y);
+
+	//World pixels to clip space with y down, matching the projection TurtleBrains uses for the world target.
+	theShaderManager.SetShaderUniform(theParticleShader, "uWorldToClip", Vector4(2.0f / worldWidth, -2.0f / worldHeight, -1.0f, 1.0f));
+	theShaderManager.SetShaderUniform(theParticleShader, "uPointScale", static_cast<float>(renderSize.x) / worldWidth);
+
+	theShaderManager.PushAndBindShader(theParticleShader);
+	theShaderManager.ApplyUniformsForDraw();
+
+	GLStateCache& stateCache = TheGLStateCache();
+	stateCache.SetBlendEnabled(true);
+
+	//Colors leave the vertex shader with the alpha multiplied in, as the TurtleBrains shaders do.
+	stateCache.SetBlendFunction(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+	RenderPool(mPools[PoolIndexOf(BlendMode::Alpha)], mPoolBuffers[PoolIndexOf(BlendMode::Alpha)]);
+
+	stateCache.SetBlendFunction(GL_ONE, GL_ONE);
+	RenderPool(mPools[PoolIndexOf(BlendMode::Additive)], mPoolBuffers[PoolIndexOf(BlendMode::Additive)]);
+
+	stateCache.SetBlendFunction(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+	stateCache.BindVertexArray(0);
+	theShaderManager.PopShader();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ParticleSystem::RenderPool(const ParticlePool& pool, PoolBuffers& buffers) const
+{
+	if (0 == pool.mCount || 0 == buffers.mVertexBuffer)
+	{
+		return;
+	}
+
+	const size_t capacity = pool.mCapacity;
+	const GLintptr positionXOffset = 0;
+	const GLintptr positionYOffset = static_cast<GLintptr>(capacity * sizeof(float));
+	const GLintptr sizeOffset = static_cast<GLintptr>(capacity * sizeof(float) * 2);
+	const GLintptr colorOffset = static_cast<GLintptr>(capacity * sizeof(float) * 3);
+	const GLsizeiptr bufferBytes = static_cast<GLsizeiptr>(capacity * (sizeof(float) * 3 + sizeof(tbCore::uint32)));
+
+	ShaderSystem::GLStateCache& stateCache = ShaderSystem::TheGLStateCache();
+	stateCache.BindVertexArray(buffers.mVertexArray);
+	tb_check_gl_errors(glBindBuffer(GL_ARRAY_BUFFER, buffers.mVertexBuffer));
+
+	//The attribute locations are looked up again whenever the program changes, a reloaded shader may move them.
+	const GLuint program = ShaderSystem::Implementation::ShaderHandleToProgramID(ShaderSystem::theParticleShader);
+	if (program != buffers.mProgram)
+	{
+		const auto setupAttribute = [program](const char* attributeName, const GLint components, const GLenum type,
+			const GLboolean normalized, const GLintptr offset) {
+			const GLint location = glGetAttribLocation(program, attributeName);
+			if (location >= 0)
+			{
+				tb_check_gl_errors(glEnableVertexAttribArray(static_cast<GLuint>(location)));
+				tb_check_gl_errors(glVertexAttribPointer(static_cast<GLuint>(location), components, type, normalized, 0,
+					reinterpret_cast<const void*>(offset)));
+			}
+		};
+
+		setupAttribute("particleX", 1, GL_FLOAT, GL_FALSE, positionXOffset);
+		setupAttribute("particleY", 1, GL_FLOAT, GL_FALSE, positionYOffset);
+		setupAttribute("particleSize", 1, GL_FLOAT, GL_FALSE, sizeOffset);
+		setupAttribute("particleColor", 4, GL_UNSIGNED_BYTE, GL_TRUE, colorOffset);
+		buffers.mProgram = program;
+	}
+
+	//Orphaned each frame so the driver can hand back fresh memory instead of waiting on last frames draw, then each
+	//  array is streamed straight out of the pool, no interleaving copy.
+	const size_t count = pool.mCount;
+	tb_check_gl_errors(glBufferData(GL_ARRAY_BUFFER, bufferBytes, nullptr, GL_STREAM_DRAW));
+	tb_check_gl_errors(glBufferSubData(GL_ARRAY_BUFFER, positionXOffset, count * sizeof(float), pool.mPositionX.data()));
+	tb_check_gl_errors(glBufferSubData(GL_ARRAY_BUFFER, positionYOffset, count * sizeof(float), pool.mPositionY.data()));
+	tb_check_gl_errors(glBufferSubData(GL_ARRAY_BUFFER, sizeOffset, count * sizeof(float), pool.mSize.data()));
+	tb_check_gl_errors(glBufferSubData(GL_ARRAY_BUFFER, colorOffset, count * sizeof(tbCore::uint32), pool.mColor.data()));
+
+	tb_check_gl_errors(glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(count)));
+	tb_check_gl_errors(glBindBuffer(GL_ARRAY_BUFFER, 0));
+	++mLastFrameStats.mDrawCalls;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ParticleSystem::OnCreateGraphicsContext(void)
+{
+	//2026-10-19: The quality is only read here, Update() runs every frame and should not look up settings by name.
+	mQuality = GetParticleQuality();
+
+	for (PoolBuffers& buffers : mPoolBuffers)
+	{
+		tb_check_gl_errors(glGenVertexArrays(1, &buffers.mVertexArray));
+		tb_check_gl_errors(glGenBuffers(1, &buffers.mVertexBuffer));
+		buffers.mProgram = 0;
+	}
+
+#if !defined(tb_web)
+	//WebGL always takes the size from gl_PointSize, desktop GL needs to be told to.
+	tb_check_gl_errors(glEnable(GL_PROGRAM_POINT_SIZE));
+#endif /* !tb_web */
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ParticleSystem::OnDestroyGraphicsContext(void)
+{
+	for (PoolBuffers& buffers : mPoolBuffers)
+	{
+		if (0 != buffers.mVertexBuffer)
+		{
+			tb_check_gl_errors(glDeleteBuffers(1, &buffers.mVertexBuffer));
+		}
+		if (0 != buffers.mVertexArray)
+		{
+			tb_check_gl_errors(glDeleteVertexArrays(1, &buffers.mVertexArray));
+		}
+		buffers = PoolBuffers();
+	}
+
+	ShaderSystem::TheGLStateCache().Invalidate();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ParticleEffect Asteroids::ParticleEffects::AsteroidDebris(const int asteroidSize)
+{
+	ParticleEffect effect;
+	effect.mBlendMode = BlendMode::Alpha;
+	effect.mCount = 24 + static_cast<size_t>(std::max(asteroidSize, 0)) * 8;
+	effect.mMinimumSpeed = 40.0f;
+	effect.mMaximumSpeed = 180.0f;
+	effect.mSpread = 3.14159265f;
+	effect.mMinimumLifetime = 0.5f;
+	effect.mMaximumLifetime = 1.2f;
+	effect.mDrag = 1.5f;
+	effect.mStartSize = 5.0f;
+	effect.mEndSize = 2.0f;
+	effect.mStartColor = 0xFFD8D0C8;
+	effect.mEndColor = 0x00605850;
+	return effect;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ParticleEffect Asteroids::ParticleEffects::BulletImpact(void)
+{
+	ParticleEffect effect;
+	effect.mBlendMode = BlendMode::Additive;
+	effect.mCount = 20;
+	effect.mMinimumSpeed = 120.0f;
+	effect.mMaximumSpeed = 360.0f;
+	effect.mSpread = 1.5f;
+	effect.mMinimumLifetime = 0.15f;
+	effect.mMaximumLifetime = 0.35f;
+	effect.mDrag = 4.0f;
+	effect.mStartSize = 4.0f;
+	effect.mEndSize = 1.0f;
+	effect.mStartColor = 0xFFFFE8A0;
+	effect.mEndColor = 0x00FF4010;
+	return effect;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class ParticleSystemTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		ParticleSystemTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::ParticleSystemTest")
+		{
+		}
+
+	protected:
+		void AddParticle(ParticlePool& pool, const float position, const float lifetime, const float drag)
+		{
+			const size_t index = pool.mCount++;
+			pool.mPositionX[index] = position;
+			pool.mPositionY[index] = -position;
+			pool.mVelocityX[index] = 100.0f;
+			pool.mVelocityY[index] = -50.0f;
+			pool.mAge[index] = 0.0f;
+			pool.mInverseLifetime[index] = 1.0f / lifetime;
+			pool.mDrag[index] = drag;
+			pool.mSizeStart[index] = 4.0f;
+			pool.mSizeDelta[index] = -3.0f;
+			for (size_t channel = 0; channel < 4; ++channel)
+			{
+				pool.mColorStart[channel][index] = 1.0f;
+				pool.mColorDelta[channel][index] = -0.25f * static_cast<float>(channel + 1);
+			}
+		}
+
+		virtual bool OnRunTest(void) override
+		{
+			const auto isNear = [](const float value, const float expected) { return std::fabs(value - expected) < 0.001f; };
+
+			{	//The four at a time update must agree with the reference, including the partial group at the end.
+				ParticlePool pool(16);
+				ParticlePool reference(16);
+				for (size_t particleIndex = 0; particleIndex < 7; ++particleIndex)
+				{
+					const float value = static_cast<float>(particleIndex);
+					AddParticle(pool, value, 1.0f + value, 0.5f * value);
+					AddParticle(reference, value, 1.0f + value, 0.5f * value);
+				}
+
+				Implementation::UpdateParticles(pool, 0.5f);
+				Implementation::UpdateParticleRange(reference, 0, reference.mCount, 0.5f);
+
+				bool isMatching = true;
+				for (size_t index = 0; index < reference.mCount; ++index)
+				{
+					isMatching &= isNear(pool.mPositionX[index], reference.mPositionX[index]);
+					isMatching &= isNear(pool.mVelocityY[index], reference.mVelocityY[index]);
+					isMatching &= isNear(pool.mSize[index], reference.mSize[index]);
+					isMatching &= (pool.mColor[index] == reference.mColor[index]);
+				}
+				ExpectedValue(isMatching, true, "Expected the batched update to match the reference update.");
+			}
+
+			{	//Velocity, drag, lifetime and the color ramp of a single particle.
+				ParticlePool pool(4);
+				AddParticle(pool, 0.0f, 2.0f, 1.0f);
+				Implementation::UpdateParticles(pool, 0.5f);
+
+				ExpectedValue(isNear(pool.mVelocityX[0], 50.0f), true, "Expected half the velocity lost to drag.");
+				ExpectedValue(isNear(pool.mPositionX[0], 25.0f), true, "Expected the particle to move by the dragged velocity.");
+				ExpectedValue(isNear(pool.mSize[0], 3.25f), true, "Expected the size to be a quarter along the ramp.");
+				ExpectedValue(pool.mColor[0] & 0xFF, tbCore::uint32(239), "Expected red a quarter along the ramp.");
+				ExpectedValue(pool.mColor[0] >> 24, tbCore::uint32(191), "Expected alpha a quarter along the ramp.");
+			}
+
+			{	//Expired particles are removed and the survivors kept.
+				ParticlePool pool(8);
+				AddParticle(pool, 1.0f, 0.25f, 0.0f);
+				AddParticle(pool, 2.0f, 5.0f, 0.0f);
+				AddParticle(pool, 3.0f, 0.25f, 0.0f);
+				AddParticle(pool, 4.0f, 5.0f, 0.0f);
+				AddParticle(pool, 5.0f, 0.25f, 0.0f);
+				Implementation::UpdateParticles(pool, 0.5f);
+
+				ExpectedValue(pool.mCount, size_t(2), "Expected the expired particles to be removed.");
+				const float first = std::min(pool.mPositionX[0], pool.mPositionX[1]);
+				const float second = std::max(pool.mPositionX[0], pool.mPositionX[1]);
+				ExpectedValue(isNear(first, 52.0f) && isNear(second, 54.0f), true, "Expected the long lived particles to survive.");
+			}
+
+			return true;
+		}
+	};
+
+	ParticleSystemTest theParticleSystemTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
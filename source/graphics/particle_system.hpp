@@ -0,0 +1,173 @@
+///
+/// @file
+/// @details A particle system for the small, short lived effects like asteroid debris and bullet impacts that would be
+///   far too many entities. Particles are kept as flat arrays, updated four at a time and streamed to the GPU as
+///   points with one draw for each blend mode.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_ParticleSystem_hpp
+#define Asteroids_ParticleSystem_hpp
+
+#include "../asteroids.hpp"
+#include "../graphics/render_layer.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+#include <turtle_brains/core/tb_opengl.hpp>
+
+#include <array>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define asteroids_particles_with_sse2
+#endif
+
+namespace Asteroids
+{
+
+	///
+	/// @details Selected by Settings::ParticleQuality(); lower qualities emit fewer particles for each effect and have
+	///   a smaller budget of particles alive at once.
+	///
+	enum class ParticleQuality { Low, Medium, High };
+
+	ParticleQuality GetParticleQuality(void);
+
+	///
+	/// @details Describes a burst of particles. Colors are 0xAARRGGBB, like Color(0x99FFFFFF), and each particle
+	///   fades from the start color and size to the end color and size over its lifetime.
+	///
+	struct ParticleEffect
+	{
+		BlendMode mBlendMode = BlendMode::Alpha;
+		size_t mCount = 16;
+		float mMinimumSpeed = 50.0f;
+		float mMaximumSpeed = 150.0f;
+		float mSpread = 6.2831853f; //radians, centered on the direction given to Emit().
+		float mMinimumLifetime = 0.4f;
+		float mMaximumLifetime = 0.8f;
+		float mDrag = 2.0f; //fraction of the velocity lost per second.
+		float mStartSize = 4.0f;
+		float mEndSize = 1.0f;
+		tbCore::uint32 mStartColor = 0xFFFFFFFF;
+		tbCore::uint32 mEndColor = 0x00FFFFFF;
+	};
+
+	///
+	/// @details Fixed capacity storage for every particle of one blend mode, one array per attribute so the update can
+	///   work on four particles at a time. The capacity is a multiple of four and slots past the count are updated
+	///   along with the rest rather than special cased, they are never drawn.
+	///
+	struct ParticlePool
+	{
+		explicit ParticlePool(const size_t capacity);
+
+		size_t mCount;
+		const size_t mCapacity;
+
+		std::vector<float> mPositionX;
+		std::vector<float> mPositionY;
+		std::vector<float> mVelocityX;
+		std::vector<float> mVelocityY;
+		std::vector<float> mAge;
+		std::vector<float> mInverseLifetime;
+		std::vector<float> mDrag;
+		std::vector<float> mSizeStart;
+		std::vector<float> mSizeDelta;
+		std::array<std::vector<float>, 4> mColorStart; //red, green, blue, alpha from 0 to 1.
+		std::array<std::vector<float>, 4> mColorDelta;
+
+		//Written by the update, ready to stream to the GPU.
+		std::vector<float> mSize;
+		std::vector<tbCore::uint32> mColor; //RGBA8 in memory order.
+
+		void MoveParticle(const size_t fromIndex, const size_t toIndex);
+	};
+
+	namespace Implementation
+	{
+		///
+		/// @details Updates the particles from begin up to end one at a time, the reference for the SSE2 path.
+		///
+		void UpdateParticleRange(ParticlePool& pool, const size_t beginIndex, const size_t endIndex, const float deltaTime);
+
+		///
+		/// @details Updates every particle in the pool, four at a time where SSE2 is available, then removes the ones
+		///   that have lived out their lifetime by swapping the last particle into their place.
+		///
+		void UpdateParticles(ParticlePool& pool, const float deltaTime);
+	};
+
+	class ParticleSystem : public tbCore::Noncopyable
+	{
+	public:
+		//Per blend mode, the budget from the quality setting is shared between them.
+		static const size_t kMaximumParticles = 32768;
+
+		struct FrameStats
+		{
+			size_t mParticlesAlive = 0;
+			size_t mParticlesEmitted = 0;
+			size_t mParticlesDropped = 0;
+			size_t mDrawCalls = 0;
+			float mUpdateTime = 0.0f; //milliseconds
+		};
+
+		ParticleSystem(void);
+		~ParticleSystem(void);
+
+		///
+		/// @details Emits a burst of the effect, each particle leaving the position along the direction, within the
+		///   spread, plus the inherited velocity. Particles past the budget are dropped.
+		///
+		void Emit(const ParticleEffect& effect, const Vector2& position, const Vector2& direction,
+			const Vector2& inheritedVelocity = Vector2::Zero());
+
+		void Update(const float deltaTime);
+		void Clear(void);
+
+		///
+		/// @details Expects the world target to be bound with the viewport applied. Draws each blend mode that has
+		///   particles alive with a single draw.
+		///
+		void Render(void) const;
+
+		size_t GetParticleCount(void) const;
+		size_t GetParticleBudget(void) const;
+		inline const FrameStats& GetLastFrameStats(void) const { return mLastFrameStats; }
+
+		void OnCreateGraphicsContext(void);
+		void OnDestroyGraphicsContext(void);
+
+	private:
+		struct PoolBuffers
+		{
+			GLuint mVertexArray = 0;
+			GLuint mVertexBuffer = 0;
+			GLuint mProgram = 0; //the attribute locations were set up for this program.
+		};
+
+		static const size_t kNumberOfPools = 2;
+		static size_t PoolIndexOf(const BlendMode blendMode);
+
+		void RenderPool(const ParticlePool& pool, PoolBuffers& buffers) const;
+
+		std::array<ParticlePool, kNumberOfPools> mPools;
+		mutable std::array<PoolBuffers, kNumberOfPools> mPoolBuffers;
+		ParticleQuality mQuality;
+		FrameStats mFrameStats;
+		mutable FrameStats mLastFrameStats;
+	};
+
+	ParticleSystem& TheParticleSystem(void);
+
+	namespace ParticleEffects
+	{
+		ParticleEffect AsteroidDebris(const int asteroidSize);
+		ParticleEffect BulletImpact(void);
+	};
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_ParticleSystem_hpp */
@@ -0,0 +1,181 @@
+///
+/// @file
+/// @details Blends between the last two simulation steps when rendering, so motion stays smooth on displays that
+///   refresh faster than the 100hz simulation instead of repeating a position for a frame or two.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/render_interpolation.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Asteroids::Implementation
+{
+	//After unwrapping, a jump further than this fraction of the world in a single step is a teleport, not motion.
+	const float kTeleportFraction = 0.25f;
+
+	const float kPi = 3.14159265358979f;
+
+	float UnwrapAxis(const float previous, const float current, const float worldExtent)
+	{
+		const float halfExtent = worldExtent * 0.5f;
+		if (current - previous > halfExtent) { return previous + worldExtent; }
+		if (previous - current > halfExtent) { return previous - worldExtent; }
+		return previous;
+	}
+
+	float ShortestTurn(const float fromRadians, const float toRadians)
+	{
+		float turn = std::fmod(toRadians - fromRadians, 2.0f * kPi);
+		if (turn > kPi) { turn -= 2.0f * kPi; }
+		if (turn < -kPi) { turn += 2.0f * kPi; }
+		return turn;
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::SimulationClock::SimulationClock(const float stepTime) :
+	mStepTime(stepTime),
+	mAccumulator(0.0f),
+	mStepsSinceFrame(0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SimulationClock::AddSimulateStep(void)
+{
+	++mStepsSinceFrame;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SimulationClock::AddFrameTime(const float deltaTime)
+{
+	mAccumulator += deltaTime - static_cast<float>(mStepsSinceFrame) * mStepTime;
+	mStepsSinceFrame = 0;
+
+	//Clamped since the real accumulator is not visible, pausing or a hitch must not leave this one drifting.
+	mAccumulator = std::clamp(mAccumulator, 0.0f, mStepTime);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float Asteroids::SimulationClock::GetInterpolation(void) const
+{
+	return mAccumulator / mStepTime;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::RenderTransform Asteroids::Implementation::InterpolateTransform(const RenderTransform& previous,
+	const RenderTransform& current, const float interpolation, const Vector2& worldSize)
+{
+	const Vector2 unwrapped(UnwrapAxis(previous.mPosition.x, current.mPosition.x, worldSize.x),
+		UnwrapAxis(previous.mPosition.y, current.mPosition.y, worldSize.y));
+
+	if (std::fabs(current.mPosition.x - unwrapped.x) > worldSize.x * kTeleportFraction ||
+		std::fabs(current.mPosition.y - unwrapped.y) > worldSize.y * kTeleportFraction)
+	{
+		return current;
+	}
+
+	RenderTransform blended;
+	blended.mPosition.x = unwrapped.x + (current.mPosition.x - unwrapped.x) * interpolation;
+	blended.mPosition.y = unwrapped.y + (current.mPosition.y - unwrapped.y) * interpolation;
+	blended.mRotation = previous.mRotation + ShortestTurn(previous.mRotation, current.mRotation) * interpolation;
+	return blended;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Implementation::InterpolateSnapshotTransforms(const RenderSnapshot& snapshot,
+	std::vector<RenderTransform>& transforms)
+{
+	const size_t objectCount = snapshot.GetRenderObjectCount();
+	transforms.resize(objectCount);
+	for (size_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+	{
+		transforms[objectIndex] = InterpolateTransform(snapshot.mPreviousTransforms[objectIndex],
+			snapshot.mTransforms[objectIndex], snapshot.mInterpolation, snapshot.mWorldSize);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class RenderInterpolationTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		RenderInterpolationTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::RenderInterpolationTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			const auto isNear = [](const float value, const float expected) { return std::fabs(value - expected) < 0.001f; };
+			const Vector2 worldSize(1920.0f, 1080.0f);
+
+			{	//A 144hz frame after one step leaves part of a step in the accumulator.
+				SimulationClock clock(0.01f);
+				clock.AddSimulateStep();
+				clock.AddFrameTime(0.014f);
+				ExpectedValue(isNear(clock.GetInterpolation(), 0.4f), true, "Expected 4ms of a 10ms step left over.");
+
+				clock.AddFrameTime(0.004f);
+				ExpectedValue(isNear(clock.GetInterpolation(), 0.8f), true, "Expected a frame without a step to move further along.");
+
+				clock.AddFrameTime(1.0f);
+				ExpectedValue(isNear(clock.GetInterpolation(), 1.0f), true, "Expected a hitch or pause to stop at the current step.");
+			}
+
+			{	//Plain motion is a straight blend.
+				const RenderTransform previous{ Vector2(100.0f, 100.0f), 0.0f };
+				const RenderTransform current{ Vector2(110.0f, 90.0f), 0.2f };
+				const RenderTransform halfway = Implementation::InterpolateTransform(previous, current, 0.5f, worldSize);
+				ExpectedValue(isNear(halfway.mPosition.x, 105.0f) && isNear(halfway.mPosition.y, 95.0f), true, "Expected the halfway position.");
+				ExpectedValue(isNear(halfway.mRotation, 0.1f), true, "Expected the halfway rotation.");
+			}
+
+			{	//Wrapping off the right edge onto the left must not streak back across the screen.
+				const RenderTransform previous{ Vector2(1965.0f, 500.0f), 0.0f };
+				const RenderTransform current{ Vector2(55.0f, 500.0f), 0.0f };
+				const RenderTransform halfway = Implementation::InterpolateTransform(previous, current, 0.5f, worldSize);
+				ExpectedValue(isNear(halfway.mPosition.x, 50.0f), true, "Expected the blend to continue in from the left edge.");
+			}
+
+			{	//Turning through zero takes the short way around.
+				const RenderTransform previous{ Vector2(0.0f, 0.0f), 6.2f };
+				const RenderTransform current{ Vector2(0.0f, 0.0f), 0.1f };
+				const RenderTransform halfway = Implementation::InterpolateTransform(previous, current, 0.5f, worldSize);
+				const float expected = 6.2f + (0.1f + 2.0f * Implementation::kPi - 6.2f) * 0.5f;
+				ExpectedValue(isNear(halfway.mRotation, expected), true, "Expected the rotation to turn the short way.");
+			}
+
+			{	//A teleport across the world snaps.
+				const RenderTransform previous{ Vector2(100.0f, 100.0f), 0.0f };
+				const RenderTransform current{ Vector2(900.0f, 600.0f), 0.0f };
+				const RenderTransform halfway = Implementation::InterpolateTransform(previous, current, 0.5f, worldSize);
+				ExpectedValue(isNear(halfway.mPosition.x, 900.0f) && isNear(halfway.mPosition.y, 600.0f), true, "Expected a teleport to snap.");
+			}
+
+			return true;
+		}
+	};
+
+	RenderInterpolationTest theRenderInterpolationTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
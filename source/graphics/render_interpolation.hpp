@@ -0,0 +1,64 @@
+///
+/// @file
+/// @details Blends between the last two simulation steps when rendering, so motion stays smooth on displays that
+///   refresh faster than the 100hz simulation instead of repeating a position for a frame or two.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_RenderInterpolation_hpp
+#define Asteroids_RenderInterpolation_hpp
+
+#include "../asteroids.hpp"
+#include "../graphics/render_snapshot.hpp"
+
+#include <vector>
+
+namespace Asteroids
+{
+
+	///
+	/// @details Mirrors the fixed step accumulator TurtleBrains keeps, which is not exposed, by counting the frame time
+	///   that comes in and the Simulate() steps that consume it. What is left over, as a fraction of a step, is how
+	///   far the render is between the previous and current step.
+	///
+	class SimulationClock
+	{
+	public:
+		explicit SimulationClock(const float stepTime = kFixedStepTime);
+
+		void AddSimulateStep(void);
+		void AddFrameTime(const float deltaTime);
+
+		///
+		/// @details 0 renders the state before the last step and 1 the state after it.
+		///
+		float GetInterpolation(void) const;
+
+	private:
+		float mStepTime;
+		float mAccumulator;
+		int mStepsSinceFrame;
+	};
+
+	namespace Implementation
+	{
+		///
+		/// @details Blends from previous to current by interpolation. When the position jumped more than half of the
+		///   world on an axis it wrapped around the edge, so the previous position is moved by the size of the world to
+		///   blend the short way rather than streaking across the screen. A jump still too big after that is treated
+		///   as a teleport and snaps to current. The rotation always turns the short way.
+		///
+		RenderTransform InterpolateTransform(const RenderTransform& previous, const RenderTransform& current,
+			const float interpolation, const Vector2& worldSize);
+
+		///
+		/// @details Fills transforms with every object in the snapshot blended by the snapshot interpolation, index N
+		///   matching index N of the snapshot arrays.
+		///
+		void InterpolateSnapshotTransforms(const RenderSnapshot& snapshot, std::vector<RenderTransform>& transforms);
+	};
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_RenderInterpolation_hpp */
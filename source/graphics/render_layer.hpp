@@ -0,0 +1,25 @@
+///
+/// @file
+/// @details The painters order and blending shared by the snapshot objects and particles drawn into the world.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_RenderLayer_hpp
+#define Asteroids_RenderLayer_hpp
+
+#include "../asteroids.hpp"
+
+namespace Asteroids
+{
+	enum class BlendMode : tbCore::uint8 { Opaque, Alpha, Additive };
+
+	///
+	/// @details Painters order within the world, anything on a lower layer is drawn before anything on a higher one no
+	///   matter the mesh it uses.
+	///
+	enum class RenderLayer : tbCore::uint16 { Backdrop, Asteroids, Projectiles, Ships, Effects, Interface };
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_RenderLayer_hpp */
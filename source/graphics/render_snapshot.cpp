@@ -0,0 +1,144 @@
+///
+/// @file
+/// @details The state the render stage consumes, captured once the update stage has finished changing the game so
+///   that submitting the frame never has to reach back into the scene for anything that can still change.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/render_snapshot.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+
+namespace Asteroids::Implementation
+{
+	std::vector<RenderObjectWriter*>& TheRenderObjectWriters(void)
+	{
+		static std::vector<RenderObjectWriter*> theRenderObjectWriters;
+		return theRenderObjectWriters;
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::RenderSnapshot::AddRenderObject(const MeshId meshId, const RenderLayer layer,
+	const RenderTransform& previousTransform, const RenderTransform& transform, const Color& color)
+{
+	mPreviousTransforms.push_back(previousTransform);
+	mTransforms.push_back(transform);
+	mColors.push_back(color);
+	mMeshes.push_back(meshId);
+	mLayers.push_back(layer);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::RenderSnapshot::ClearRenderObjects(void)
+{
+	mPreviousTransforms.clear();
+	mTransforms.clear();
+	mColors.clear();
+	mMeshes.clear();
+	mLayers.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::RenderObjectWriter::WriteRenderObjects(const tbGame::EntityManager& owner, RenderSnapshot& snapshot)
+{
+	for (const RenderObjectWriter* writer : Implementation::TheRenderObjectWriters())
+	{
+		if (&owner == writer->mOwner)
+		{
+			writer->OnWriteRenderObjects(snapshot);
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::RenderObjectWriter::RenderObjectWriter(void) :
+	mOwner(nullptr)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::RenderObjectWriter::~RenderObjectWriter(void)
+{
+	StopWritingRenderObjects();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::RenderObjectWriter::StartWritingRenderObjects(const tbGame::EntityManager* owner)
+{
+	tb_error_if(nullptr == owner, "RenderObjectWriter expected an EntityManager to write for.");
+
+	StopWritingRenderObjects();
+	mOwner = owner;
+	Implementation::TheRenderObjectWriters().push_back(this);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::RenderObjectWriter::StopWritingRenderObjects(void)
+{
+	if (nullptr == mOwner)
+	{
+		return;
+	}
+
+	std::vector<RenderObjectWriter*>& writers = Implementation::TheRenderObjectWriters();
+	writers.erase(std::remove(writers.begin(), writers.end(), this), writers.end());
+	mOwner = nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class RenderSnapshotTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		RenderSnapshotTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::RenderSnapshotTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			RenderSnapshot snapshot;
+			const RenderTransform previousTransform{ Vector2(5.0f, 20.0f), 0.25f };
+			const RenderTransform transform{ Vector2(10.0f, 20.0f), 0.5f };
+
+			snapshot.AddRenderObject(MakeMeshId(MeshKind::Asteroid, 3), RenderLayer::Asteroids, previousTransform, transform, tbGraphics::ColorPalette::White);
+			snapshot.AddRenderObject(MakeMeshId(MeshKind::RocketShip), RenderLayer::Ships, transform, transform, tbGraphics::ColorPalette::White);
+			ExpectedValue(snapshot.GetRenderObjectCount(), size_t(2), "Expected both objects in the snapshot.");
+			ExpectedValue(snapshot.mPreviousTransforms.size() == 2 && snapshot.mTransforms.size() == 2 &&
+				snapshot.mColors.size() == 2 && snapshot.mLayers.size() == 2, true, "Expected every array to hold each object.");
+			ExpectedValue(snapshot.mPreviousTransforms[0].mPosition.x, 5.0f, "Expected index 0 of each array to be the asteroid.");
+			ExpectedValue(snapshot.mMeshes[1], MakeMeshId(MeshKind::RocketShip), "Expected index 1 of each array to be the ship.");
+
+			//Capturing the next frame starts from nothing, while holding onto the capacity.
+			const size_t capacity = snapshot.mMeshes.capacity();
+			snapshot.ClearRenderObjects();
+			ExpectedValue(snapshot.GetRenderObjectCount(), size_t(0), "Expected ClearRenderObjects() to clear the old objects.");
+			ExpectedValue(snapshot.mTransforms.empty() && snapshot.mColors.empty(), true, "Expected every array to be cleared.");
+			ExpectedValue(snapshot.mMeshes.capacity(), capacity, "Expected the capacity to be kept for the next capture.");
+
+			return true;
+		}
+	};
+
+	RenderSnapshotTest theRenderSnapshotTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
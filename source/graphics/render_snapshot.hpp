@@ -0,0 +1,99 @@
+///
+/// @file
+/// @details The state the render stage consumes, captured once the update stage has finished changing the game so
+///   that submitting the frame never has to reach back into the scene for anything that can still change.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_RenderSnapshot_hpp
+#define Asteroids_RenderSnapshot_hpp
+
+#include "../asteroids.hpp"
+#include "../graphics/fog_of_wilderness_effect.hpp"
+#include "../graphics/mesh_library.hpp"
+#include "../graphics/render_layer.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+
+#include <vector>
+
+namespace Asteroids
+{
+
+	struct RenderTransform
+	{
+		Vector2 mPosition;
+		float mRotation; //radians
+	};
+
+	///
+	/// @details Kept by value and refilled each frame, the vectors inside hold onto their capacity so capturing does
+	///   not allocate once the game has settled. The scene holds a single snapshot, captured and then drawn by the
+	///   main thread within OnRender().
+	///
+	///   The objects are stored as parallel flat arrays, index N of each describes the same object, and hold nothing
+	///   that points back into an entity so the snapshot stays valid however the game changes after it was captured.
+	///
+	struct RenderSnapshot
+	{
+		size_t mFrameNumber = 0;
+		float mDeltaTime = 0.0f;
+
+		//The world target as allocated and the corner of it dynamic resolution renders into this frame.
+		IntVector2 mWorldTargetSize{ 0, 0 };
+		IntVector2 mRenderSize{ 0, 0 };
+
+		bool mHasFogOfWilderness = false;
+		FogOfWildernessSnapshot mFogOfWilderness;
+
+		//How far between the previous and current transforms to render, from SimulationClock, and the size of the
+		//  world the objects wrap around in so the blend can follow them over the edge.
+		float mInterpolation = 1.0f;
+		Vector2 mWorldSize{ 0.0f, 0.0f };
+
+		std::vector<RenderTransform> mPreviousTransforms;
+		std::vector<RenderTransform> mTransforms;
+		std::vector<Color> mColors;
+		std::vector<MeshId> mMeshes;
+		std::vector<RenderLayer> mLayers;
+
+		///
+		/// @details The previous transform is where the object was before the most recent Simulate() step, and the
+		///   transform is where it is now. Pass the same transform twice for anything that should not be blended.
+		///
+		void AddRenderObject(const MeshId meshId, const RenderLayer layer, const RenderTransform& previousTransform,
+			const RenderTransform& transform, const Color& color);
+		void ClearRenderObjects(void);
+		inline size_t GetRenderObjectCount(void) const { return mMeshes.size(); }
+	};
+
+	///
+	/// @details Anything in the world that wants to be drawn from the snapshot derives from this, registers once it is
+	///   in an EntityManager and writes its objects when that manager captures a snapshot. The destructor unregisters
+	///   so a writer can never be left dangling in the registry.
+	///
+	class RenderObjectWriter
+	{
+	public:
+		///
+		/// @details Calls OnWriteRenderObjects() on every writer registered with the owner, in registration order.
+		///
+		static void WriteRenderObjects(const tbGame::EntityManager& owner, RenderSnapshot& snapshot);
+
+		RenderObjectWriter(void);
+		virtual ~RenderObjectWriter(void);
+
+	protected:
+		void StartWritingRenderObjects(const tbGame::EntityManager* owner);
+		void StopWritingRenderObjects(void);
+
+		virtual void OnWriteRenderObjects(RenderSnapshot& snapshot) const = 0;
+
+	private:
+		const tbGame::EntityManager* mOwner;
+	};
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_RenderSnapshot_hpp */
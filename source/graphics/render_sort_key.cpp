@@ -0,0 +1,235 @@
+///
+/// @file
+/// @details The 64-bit key the snapshot renderer sorts its draws by so objects sharing a shader, texture and blend
+///   are drawn back to back without breaking the painters order between layers.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/render_sort_key.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <array>
+
+namespace Asteroids::Implementation
+{
+	const int kPassShift = 60;
+	const int kLayerShift = 48;
+	const int kBlendShift = 44;
+	const int kShaderShift = 32;
+	const int kTextureShift = 16;
+
+	const RenderSortKey kPassMask = 0xF;
+	const RenderSortKey kLayerMask = 0xFFF;
+	const RenderSortKey kBlendMask = 0xF;
+	const RenderSortKey kShaderMask = 0xFFF;
+	const RenderSortKey kTextureMask = 0xFFFF;
+	const RenderSortKey kMeshMask = 0xFFFF;
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::RenderSortKey Asteroids::MakeRenderSortKey(const RenderPass pass, const RenderLayer layer,
+	const BlendMode blend, const tbCore::uint32 shaderKey, const tbCore::uint16 textureKey, const tbCore::uint16 meshKey)
+{
+	using namespace Implementation;
+	return ((static_cast<RenderSortKey>(pass) & kPassMask) << kPassShift) |
+		((static_cast<RenderSortKey>(layer) & kLayerMask) << kLayerShift) |
+		((static_cast<RenderSortKey>(blend) & kBlendMask) << kBlendShift) |
+		((static_cast<RenderSortKey>(shaderKey) & kShaderMask) << kShaderShift) |
+		((static_cast<RenderSortKey>(textureKey) & kTextureMask) << kTextureShift) |
+		(static_cast<RenderSortKey>(meshKey) & kMeshMask);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint16 Asteroids::MakeTextureKey(const String& textureFilepath)
+{
+	//FNV-1a, unlike std::hash this is stable between runs which makes comparing captures a little easier.
+	tbCore::uint32 hash = 2166136261u;
+	for (const char character : textureFilepath)
+	{
+		hash ^= static_cast<tbCore::uint8>(character);
+		hash *= 16777619u;
+	}
+
+	const tbCore::uint16 textureKey = static_cast<tbCore::uint16>((hash >> 16) ^ (hash & 0xFFFF));
+	return (0 == textureKey) ? 1 : textureKey;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::RenderPass Asteroids::Implementation::PassOf(const RenderSortKey sortKey)
+{
+	return static_cast<RenderPass>((sortKey >> kPassShift) & kPassMask);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint32 Asteroids::Implementation::BlendOf(const RenderSortKey sortKey)
+{
+	return static_cast<tbCore::uint32>((sortKey >> kBlendShift) & kBlendMask);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint32 Asteroids::Implementation::ShaderOf(const RenderSortKey sortKey)
+{
+	return static_cast<tbCore::uint32>((sortKey >> kShaderShift) & kShaderMask);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint32 Asteroids::Implementation::TextureOf(const RenderSortKey sortKey)
+{
+	return static_cast<tbCore::uint32>((sortKey >> kTextureShift) & kTextureMask);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::Implementation::CountStateChanges(const std::vector<DrawKey>& drawKeys)
+{
+	size_t stateChanges = 0;
+	for (size_t keyIndex = 1; keyIndex < drawKeys.size(); ++keyIndex)
+	{
+		const RenderSortKey previousKey = drawKeys[keyIndex - 1].mSortKey;
+		const RenderSortKey currentKey = drawKeys[keyIndex].mSortKey;
+		stateChanges += (ShaderOf(previousKey) != ShaderOf(currentKey)) ? 1 : 0;
+		stateChanges += (TextureOf(previousKey) != TextureOf(currentKey)) ? 1 : 0;
+		stateChanges += (BlendOf(previousKey) != BlendOf(currentKey)) ? 1 : 0;
+	}
+
+	return stateChanges;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Implementation::RadixSortDrawKeys(std::vector<DrawKey>& drawKeys, std::vector<DrawKey>& scratch)
+{
+	const size_t kDigitCount = sizeof(RenderSortKey);
+	const size_t kBucketCount = 256;
+
+	if (true == drawKeys.empty())
+	{
+		return;
+	}
+
+	//Build every histogram in a single pass over the keys.
+	std::array<std::array<size_t, kBucketCount>, kDigitCount> histograms{};
+	for (const DrawKey& drawKey : drawKeys)
+	{
+		for (size_t digit = 0; digit < kDigitCount; ++digit)
+		{
+			++histograms[digit][(drawKey.mSortKey >> (digit * 8)) & 0xFF];
+		}
+	}
+
+	scratch.resize(drawKeys.size());
+	for (size_t digit = 0; digit < kDigitCount; ++digit)
+	{
+		std::array<size_t, kBucketCount>& histogram = histograms[digit];
+
+		//When every key shares this digit the pass would not move anything.
+		if (drawKeys.size() == histogram[(drawKeys.front().mSortKey >> (digit * 8)) & 0xFF])
+		{
+			continue;
+		}
+
+		size_t offset = 0;
+		for (size_t& bucket : histogram)
+		{
+			const size_t count = bucket;
+			bucket = offset;
+			offset += count;
+		}
+
+		for (const DrawKey& drawKey : drawKeys)
+		{
+			scratch[histogram[(drawKey.mSortKey >> (digit * 8)) & 0xFF]++] = drawKey;
+		}
+
+		drawKeys.swap(scratch);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class RenderSortKeyTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		RenderSortKeyTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::RenderSortKeyTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace Implementation;
+
+			const tbCore::uint16 laserTexture = MakeTextureKey("data/laser_sprites/01.png");
+			const RenderSortKey laser = MakeRenderSortKey(RenderPass::World, RenderLayer::Projectiles, BlendMode::Alpha, 0, laserTexture, 7);
+			ExpectedValue(PassOf(laser) == RenderPass::World, true, "Expected the pass to survive the key.");
+			ExpectedValue(BlendOf(laser), static_cast<tbCore::uint32>(BlendMode::Alpha), "Expected the blend to survive the key.");
+			ExpectedValue(TextureOf(laser), static_cast<tbCore::uint32>(laserTexture), "Expected the texture to survive the key.");
+			ExpectedValue(laserTexture == MakeTextureKey("data/laser_sprites/01.png"), true, "Expected texture keys to be stable.");
+
+			//The layer outranks every bit of state below it, painters order must win over batching.
+			const RenderSortKey lowLayer = MakeRenderSortKey(RenderPass::World, RenderLayer::Asteroids, BlendMode::Additive, 0xFFF, 0xFFFF, 0xFFFF);
+			const RenderSortKey highLayer = MakeRenderSortKey(RenderPass::World, RenderLayer::Ships, BlendMode::Opaque, 0, 0, 0);
+			const RenderSortKey interfaceKey = MakeRenderSortKey(PassOfLayer(RenderLayer::Interface), RenderLayer::Backdrop, BlendMode::Opaque, 0, 0, 0);
+			ExpectedValue(lowLayer < highLayer, true, "Expected a lower layer to sort first whatever its state.");
+			ExpectedValue(highLayer < interfaceKey, true, "Expected the interface pass to sort after the whole world.");
+
+			return true;
+		}
+	};
+
+	RenderSortKeyTest theRenderSortKeyTest;
+
+	class RadixSortDrawKeysTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		RadixSortDrawKeysTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::RadixSortDrawKeysTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace Implementation;
+
+			const RenderSortKey asteroid = MakeRenderSortKey(RenderPass::World, RenderLayer::Asteroids, BlendMode::Opaque, 0, 0, 2);
+			const RenderSortKey laser = MakeRenderSortKey(RenderPass::World, RenderLayer::Projectiles, BlendMode::Alpha, 0, 0x1234, 5);
+			const RenderSortKey otherAsteroid = MakeRenderSortKey(RenderPass::World, RenderLayer::Asteroids, BlendMode::Opaque, 0, 0, 1);
+
+			std::vector<DrawKey> drawKeys = { { laser, 0 }, { asteroid, 1 }, { otherAsteroid, 2 }, { laser, 3 }, { asteroid, 4 } };
+			ExpectedValue(CountStateChanges(drawKeys), size_t(6), "Expected the traversal order to change blend and texture at each swap.");
+
+			std::vector<DrawKey> scratch;
+			RadixSortDrawKeys(drawKeys, scratch);
+
+			ExpectedValue(drawKeys.size(), size_t(5), "Expected every key to be kept.");
+			ExpectedValue(drawKeys[0].mObjectIndex, tbCore::uint32(2), "Expected the lowest key first.");
+			ExpectedValue(drawKeys[1].mObjectIndex, tbCore::uint32(1), "Expected equal keys to keep their written order.");
+			ExpectedValue(drawKeys[2].mObjectIndex, tbCore::uint32(4), "Expected equal keys to keep their written order.");
+			ExpectedValue(drawKeys[3].mObjectIndex, tbCore::uint32(0), "Expected the projectiles after the asteroids.");
+			ExpectedValue(drawKeys[4].mObjectIndex, tbCore::uint32(3), "Expected equal keys to keep their written order.");
+			ExpectedValue(CountStateChanges(drawKeys), size_t(2), "Expected the sorted order to change blend and texture once.");
+
+			return true;
+		}
+	};
+
+	RadixSortDrawKeysTest theRadixSortDrawKeysTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,73 @@
+///
+/// @file
+/// @details The 64-bit key the snapshot renderer sorts its draws by so objects sharing a shader, texture and blend
+///   are drawn back to back without breaking the painters order between layers.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_RenderSortKey_hpp
+#define Asteroids_RenderSortKey_hpp
+
+#include "../asteroids.hpp"
+#include "../graphics/render_layer.hpp"
+
+#include <vector>
+
+namespace Asteroids
+{
+	enum class RenderPass : tbCore::uint8 { World, Interface, NumberOfPasses };
+
+	///
+	/// @details The sort key is laid out from most to least significant so that sorting groups the draws by pass, then
+	///   by layer, which is the depth for 2D and keeps the painters order, then blend, shader, texture and mesh.
+	///
+	///   | pass (4) | layer (12) | blend (4) | shader (12) | texture (16) | mesh (16) |
+	///
+	using RenderSortKey = tbCore::uint64;
+
+	struct DrawKey
+	{
+		RenderSortKey mSortKey;
+		tbCore::uint32 mObjectIndex;
+	};
+
+	///
+	/// @details Anything on the Interface layer is drawn in the interface pass, everything else is in the world.
+	///
+	constexpr RenderPass PassOfLayer(const RenderLayer layer)
+	{
+		return (RenderLayer::Interface == layer) ? RenderPass::Interface : RenderPass::World;
+	}
+
+	RenderSortKey MakeRenderSortKey(const RenderPass pass, const RenderLayer layer, const BlendMode blend,
+		const tbCore::uint32 shaderKey, const tbCore::uint16 textureKey, const tbCore::uint16 meshKey);
+
+	///
+	/// @details Creates a key to stand in for a texture in the sort key from the filepath of the texture, which is
+	///   stable for the lifetime of the application. 0 is kept for shapes that draw without a texture.
+	///
+	tbCore::uint16 MakeTextureKey(const String& textureFilepath);
+
+	namespace Implementation
+	{
+		RenderPass PassOf(const RenderSortKey sortKey);
+		tbCore::uint32 BlendOf(const RenderSortKey sortKey);
+		tbCore::uint32 ShaderOf(const RenderSortKey sortKey);
+		tbCore::uint32 TextureOf(const RenderSortKey sortKey);
+
+		///
+		/// @details Counts the shader, texture and blend changes drawing the keys in their current order would cause.
+		///
+		size_t CountStateChanges(const std::vector<DrawKey>& drawKeys);
+
+		///
+		/// @details A stable least-significant-digit radix sort on the sort key, 8 bits per pass and any pass where
+		///   every key shares the same digit gets skipped.
+		///
+		void RadixSortDrawKeys(std::vector<DrawKey>& drawKeys, std::vector<DrawKey>& scratch);
+	};
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_RenderSortKey_hpp */
@@ -0,0 +1,127 @@
+///
+/// @file
+/// @details Hands out RenderTargets by size and format and recycles them, so a window being dragged to a new size or
+///   an effect changing its resolution does not reallocate framebuffers every frame.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/render_target_pool.hpp"
+#include "../logging.hpp"
+
+#include <algorithm>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::RenderTargetPool& Asteroids::TheRenderTargetPool(void)
+{
+	static RenderTargetPool theRenderTargetPool;
+	return theRenderTargetPool;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::RenderTargetPool::RenderTargetPool(void) :
+	tbCore::Noncopyable(),
+	mEntries(),
+	mFrame(0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::RenderTargetPool::~RenderTargetPool(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbGraphics::RenderTarget& Asteroids::RenderTargetPool::Acquire(const int width, const int height, const RenderTargetFormat format)
+{
+	tb_error_if(width <= 0 || height <= 0, "RenderTargetPool cannot create a %dx%d target.", width, height);
+
+	for (Entry& entry : mEntries)
+	{
+		if (false == entry.mIsInUse && width == entry.mWidth && height == entry.mHeight && format == entry.mFormat)
+		{
+			entry.mIsInUse = true;
+			return *entry.mRenderTarget;
+		}
+	}
+
+	tb_debug_log(LogGraphics::Info() << "RenderTargetPool creating a " << width << "x" << height << " target.");
+	mEntries.push_back(Entry{ std::make_unique<tbGraphics::RenderTarget>(width, height), width, height, format, mFrame, true });
+	return *mEntries.back().mRenderTarget;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::RenderTargetPool::Release(tbGraphics::RenderTarget& renderTarget)
+{
+	for (Entry& entry : mEntries)
+	{
+		if (&renderTarget == entry.mRenderTarget.get())
+		{
+			tb_error_if(false == entry.mIsInUse, "RenderTargetPool target was released twice.");
+			entry.mIsInUse = false;
+			entry.mReleasedFrame = mFrame;
+			return;
+		}
+	}
+
+	tb_error("RenderTargetPool was asked to release a target it does not own.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::RenderTargetPool::BeginFrame(void)
+{
+	++mFrame;
+
+	mEntries.erase(std::remove_if(mEntries.begin(), mEntries.end(), [this](const Entry& entry) {
+		return false == entry.mIsInUse && mFrame - entry.mReleasedFrame > kFramesBeforeTrim;
+	}), mEntries.end());
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::RenderTargetPool::DestroyAll(void)
+{
+	tb_error_if(0 != GetTargetsInUse(), "RenderTargetPool is being destroyed while %d targets are still in use.",
+		static_cast<int>(GetTargetsInUse()));
+	mEntries.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::RenderTargetPool::GetResidentBytes(void) const
+{
+	size_t residentBytes = 0;
+	for (const Entry& entry : mEntries)
+	{
+		residentBytes += static_cast<size_t>(entry.mWidth) * static_cast<size_t>(entry.mHeight) * BytesPerPixel(entry.mFormat);
+	}
+
+	return residentBytes;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::RenderTargetPool::GetTargetsInUse(void) const
+{
+	return static_cast<size_t>(std::count_if(mEntries.begin(), mEntries.end(), [](const Entry& entry) { return entry.mIsInUse; }));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::RenderTargetPool::BytesPerPixel(const RenderTargetFormat format)
+{
+	switch (format)
+	{
+	case RenderTargetFormat::ColorRGBA8: return 4;
+	};
+
+	return 4;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
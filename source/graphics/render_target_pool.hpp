@@ -0,0 +1,84 @@
+///
+/// @file
+/// @details Hands out RenderTargets by size and format and recycles them, so a window being dragged to a new size or
+///   an effect changing its resolution does not reallocate framebuffers every frame.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_RenderTargetPool_hpp
+#define Asteroids_RenderTargetPool_hpp
+
+#include "../asteroids.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+#include <turtle_brains/graphics/tb_render_target.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace Asteroids
+{
+
+	///
+	/// @details TurtleBrains only creates RGBA8 color targets today, the format is part of the key so a second format
+	///   can be added without every caller sharing targets they should not.
+	///
+	enum class RenderTargetFormat : tbCore::uint8 { ColorRGBA8 };
+
+	class RenderTargetPool : public tbCore::Noncopyable
+	{
+	public:
+		//A released target that has not been acquired again for this many frames gets destroyed.
+		static const size_t kFramesBeforeTrim = 120;
+
+		RenderTargetPool(void);
+		~RenderTargetPool(void);
+
+		///
+		/// @details Returns a target of exactly this size and format that is not in use, creating one only if none is
+		///   free. The contents are whatever was last rendered into it; clear before use.
+		///
+		tbGraphics::RenderTarget& Acquire(const int width, const int height, const RenderTargetFormat format = RenderTargetFormat::ColorRGBA8);
+		void Release(tbGraphics::RenderTarget& renderTarget);
+
+		///
+		/// @details Advances the frame count and destroys free targets that have gone unused for kFramesBeforeTrim.
+		///
+		void BeginFrame(void);
+
+		///
+		/// @details Destroys every target, all of them must have been released first. Called after the scenes are gone
+		///   so the targets do not outlive the application in the static pool.
+		///
+		void DestroyAll(void);
+
+		///
+		/// @details The estimated GPU memory held by every target in the pool, in use or free.
+		///
+		size_t GetResidentBytes(void) const;
+		size_t GetTargetCount(void) const { return mEntries.size(); }
+		size_t GetTargetsInUse(void) const;
+
+	private:
+		struct Entry
+		{
+			std::unique_ptr<tbGraphics::RenderTarget> mRenderTarget;
+			int mWidth;
+			int mHeight;
+			RenderTargetFormat mFormat;
+			size_t mReleasedFrame;
+			bool mIsInUse;
+		};
+
+		static size_t BytesPerPixel(const RenderTargetFormat format);
+
+		std::vector<Entry> mEntries;
+		size_t mFrame;
+	};
+
+	RenderTargetPool& TheRenderTargetPool(void);
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_RenderTargetPool_hpp */
@@ -13,7 +13,7 @@
 //--------------------------------------------------------------------------------------------------------------------//
 
 Asteroids::RocketShipShape::RocketShipShape(const tbGraphics::Color& color, const Vector2& position) :
-	AsteroidShape(3, 48.0f, color, position)
+	AsteroidShape(3, kRadius, color, position)
 {
 }
 
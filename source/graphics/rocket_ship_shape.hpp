@@ -22,6 +22,8 @@ namespace Asteroids
 	class RocketShipShape : public AsteroidShape
 	{
 	public:
+		static constexpr float kRadius = 48.0f;
+
 		explicit RocketShipShape(const tbGraphics::Color& color = tbGraphics::ColorPalette::White, const Vector2& position = Vector2::Zero());
 
 		virtual ~RocketShipShape(void);
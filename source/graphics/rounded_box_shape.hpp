@@ -9,14 +9,16 @@
 #define Asteroids_RoundedBoxShape_hpp
 
 #include "../interface.hpp"
-
-#include <turtle_brains/graphics/tb_graphic.hpp>
-#include <turtle_brains/graphics/tb_sprite.hpp>
+#include "../graphics/sdf_shape.hpp"
 
 namespace Asteroids
 {
 
-	class RoundedBoxShape : public tbGraphics::Graphic
+	///
+	/// @details A box with rounded corners and an optional border drawn around the outside, a single quad for the
+	///   signed distance field shader.
+	///
+	class RoundedBoxShape : public SdfShape
 	{
 	public:
 		explicit RoundedBoxShape(const tbMath::Vector2& size, const tbMath::Vector2& position,
@@ -25,26 +27,8 @@ namespace Asteroids
 			const bool& topCorners = true, const bool& bottomCorners = true);
 		virtual ~RoundedBoxShape(void);
 
-		inline virtual tbGraphics::PixelSpace GetPixelWidth(void) const override {
-			return static_cast<tbGraphics::PixelSpace>(mSize.x);
-		};
-		inline virtual tbGraphics::PixelSpace GetPixelHeight(void) const override {
-			return static_cast<tbGraphics::PixelSpace>(mSize.y);
-		};
-
 	protected:
 		virtual void OnUpdate(const float deltaTime) override;
-		virtual void OnRender(void) const override;
-
-		void DrawRoundedBox(const Vector2& offset, const Vector2& size, const Color& color) const;
-
-	private:
-		Color mBorderColor;
-		Vector2 mSize;
-		Vector2 mBorder;
-		float mCornerRadius;
-		bool mTopCorners;
-		bool mBottomCorners;
 	};
 
 };	//namespace Asteroids
@@ -0,0 +1,200 @@
+///
+/// @file
+/// @details The base of the interface shapes drawn by the signed distance field shader, a rounded box, circle or arc
+///   is a single quad with its shape described by a few uniforms instead of triangles tessellated on the CPU.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/sdf_shape.hpp"
+#include "../shader_system/shaders.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Asteroids::Implementation
+{
+	SdfShape::FrameStats theSdfShapeStats;
+	SdfShape::FrameStats theLastSdfShapeStats;
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Vector4 Asteroids::Implementation::MakeCornerRadii(const Vector2& size, const float cornerRadius,
+	const bool topCorners, const bool bottomCorners)
+{
+	const float radius = tbMath::Clamp(cornerRadius, 0.0f, std::min(size.x, size.y) * 0.5f);
+	const float topRadius = (true == topCorners) ? radius : 0.0f;
+	const float bottomRadius = (true == bottomCorners) ? radius : 0.0f;
+	return Vector4(bottomRadius, topRadius, bottomRadius, topRadius);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Vector2 Asteroids::Implementation::MakeArcSweep(const float startAngleRadians, const float endAngleRadians)
+{
+	const float sweep = endAngleRadians - startAngleRadians;
+	if (sweep >= tbMath::kTwoPi || sweep <= -tbMath::kTwoPi)
+	{
+		return Vector2(startAngleRadians, tbMath::kTwoPi);
+	}
+
+	//A backwards arc covers the same pixels as the forward arc from its end.
+	return (sweep < 0.0f) ? Vector2(endAngleRadians, -sweep) : Vector2(startAngleRadians, sweep);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::SdfShape::SdfShape(const ShapeKind shapeKind, const Vector2& size, const Color& fillColor, const float border,
+	const Color& borderColor) :
+	tbGraphics::PolygonShape(),
+	mCornerRadii(0.0f, 0.0f, 0.0f, 0.0f),
+	mArc(0.0f, 0.0f, 0.0f, 0.0f),
+	mSize(size),
+	mBorderColor(borderColor),
+	mBorder(std::max(0.0f, border)),
+	mShapeKind(shapeKind),
+	mWasRebuilt(false)
+{
+	SetColor(fillColor);
+	RebuildQuad();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::SdfShape::~SdfShape(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SdfShape::BeginFrame(void)
+{
+	Implementation::theLastSdfShapeStats = Implementation::theSdfShapeStats;
+	Implementation::theSdfShapeStats = FrameStats();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const Asteroids::SdfShape::FrameStats& Asteroids::SdfShape::GetLastFrameStats(void)
+{
+	return Implementation::theLastSdfShapeStats;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SdfShape::SetShapeSize(const Vector2& size)
+{
+	if (size != mSize)
+	{
+		mSize = size;
+		RebuildQuad();
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SdfShape::RebuildQuad(void)
+{
+	//A pixel past the border leaves room for the anti-aliased edge. The texture coordinates carry the position from
+	//  the center of the shape which the shader measures the distance from.
+	const float margin = mBorder + 1.0f;
+	const Vector2 center = mSize * 0.5f;
+	const Vector2 corners[4] = {
+		Vector2(-margin, -margin),
+		Vector2(mSize.x + margin, -margin),
+		Vector2(mSize.x + margin, mSize.y + margin),
+		Vector2(-margin, mSize.y + margin),
+	};
+
+	ClearVertices();
+	SetAsTriangleFan();
+	for (const Vector2& corner : corners)
+	{
+		AddVertex(corner, ColorPalette::White, corner - center);
+	}
+
+	RecomputeBounds();
+
+	++Implementation::theSdfShapeStats.mShapesRebuilt;
+	mWasRebuilt = true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SdfShape::OnRender(void) const
+{
+	using namespace ShaderSystem;
+
+	if (false == mWasRebuilt)
+	{
+		++Implementation::theSdfShapeStats.mShapesReused;
+	}
+	mWasRebuilt = false;
+
+	//Changing the shape, like the sweep of a progress arc, is only ever a change to these uniforms.
+	theShaderManager.SetShaderUniform(theSdfShapeShader, "uShapeSize", Vector4(mSize.x * 0.5f, mSize.y * 0.5f, mBorder,
+		(ShapeKind::RoundedBox == mShapeKind) ? 0.0f : 1.0f));
+	theShaderManager.SetShaderUniform(theSdfShapeShader, "uShapeCorners", mCornerRadii);
+	theShaderManager.SetShaderUniform(theSdfShapeShader, "uShapeArc", mArc);
+	theShaderManager.SetShaderUniform(theSdfShapeShader, "uShapeBorderColor", Vector4(mBorderColor.GetRed(),
+		mBorderColor.GetGreen(), mBorderColor.GetBlue(), mBorderColor.GetAlpha()));
+
+	theShaderManager.PushAndBindShader(theSdfShapeShader);
+	theShaderManager.ApplyUniformsForDraw();
+
+	PolygonShape::OnRender();
+
+	theShaderManager.PopShader();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class SdfShapeTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		SdfShapeTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::SdfShapeTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			const auto isNear = [](const float value, const float expected) { return std::fabs(value - expected) < 0.001f; };
+
+			const Vector4 allCorners = Implementation::MakeCornerRadii(Vector2(100.0f, 40.0f), 10.0f, true, true);
+			ExpectedValue(isNear(allCorners.x, 10.0f) && isNear(allCorners.w, 10.0f), true, "Expected every corner rounded.");
+
+			const Vector4 clamped = Implementation::MakeCornerRadii(Vector2(100.0f, 40.0f), 50.0f, true, true);
+			ExpectedValue(isNear(clamped.y, 20.0f), true, "Expected the radius clamped to half the shorter side.");
+
+			const Vector4 topOnly = Implementation::MakeCornerRadii(Vector2(100.0f, 40.0f), 10.0f, true, false);
+			ExpectedValue(isNear(topOnly.x, 0.0f) && isNear(topOnly.y, 10.0f), true, "Expected square bottom corners.");
+			ExpectedValue(isNear(topOnly.z, 0.0f) && isNear(topOnly.w, 10.0f), true, "Expected square bottom corners on both sides.");
+
+			const Vector2 quarter = Implementation::MakeArcSweep(0.0f, tbMath::kPi * 0.5f);
+			ExpectedValue(isNear(quarter.x, 0.0f) && isNear(quarter.y, tbMath::kPi * 0.5f), true, "Expected a quarter arc.");
+
+			const Vector2 backwards = Implementation::MakeArcSweep(tbMath::kPi, 0.0f);
+			ExpectedValue(isNear(backwards.x, 0.0f) && isNear(backwards.y, tbMath::kPi), true, "Expected a backwards arc flipped.");
+
+			const Vector2 overfull = Implementation::MakeArcSweep(1.0f, 1.0f + tbMath::kTwoPi * 2.0f);
+			ExpectedValue(isNear(overfull.y, tbMath::kTwoPi), true, "Expected the sweep to stop at a full turn.");
+
+			return true;
+		}
+	};
+
+	SdfShapeTest theSdfShapeTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
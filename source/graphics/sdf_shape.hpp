@@ -0,0 +1,97 @@
+///
+/// @file
+/// @details The base of the interface shapes drawn by the signed distance field shader, a rounded box, circle or arc
+///   is a single quad with its shape described by a few uniforms instead of triangles tessellated on the CPU.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_SdfShape_hpp
+#define Asteroids_SdfShape_hpp
+
+#include "../asteroids.hpp"
+
+#include <turtle_brains/graphics/tb_graphic.hpp>
+#include <turtle_brains/graphics/tb_basic_shapes.hpp>
+
+namespace Asteroids
+{
+
+	namespace Implementation
+	{
+		///
+		/// @details Radius of each corner in the order the shader expects: bottom right, top right, bottom left, top
+		///   left. The radius is clamped to half the shorter side, corners that are not rounded get zero.
+		///
+		Vector4 MakeCornerRadii(const Vector2& size, const float cornerRadius, const bool topCorners, const bool bottomCorners);
+
+		///
+		/// @details The start angle and the sweep from start to end, both in radians. The sweep is kept between zero
+		///   and a full turn, a sweep of a full turn draws the entire ring.
+		///
+		Vector2 MakeArcSweep(const float startAngleRadians, const float endAngleRadians);
+	};
+
+	class SdfShape : public tbGraphics::PolygonShape
+	{
+	public:
+		struct FrameStats
+		{
+			size_t mShapesRebuilt = 0;
+			size_t mShapesReused = 0; //rendered without rebuilding the quad since they were last rendered.
+		};
+
+		///
+		/// @details Call once a frame before anything is updated, the stats of the frame before are kept for
+		///   GetLastFrameStats(). In a menu that is not changing size every shape should be reused.
+		///
+		static void BeginFrame(void);
+		static const FrameStats& GetLastFrameStats(void);
+
+		virtual ~SdfShape(void);
+
+		///
+		/// @details Only rebuilds the quad when the size actually changes, so this is safe to call every update. Color,
+		///   border color, position and origin never rebuild anything.
+		///
+		void SetShapeSize(const Vector2& size);
+
+		inline float GetBorder(void) const { return mBorder; }
+		inline const Color& GetBorderColor(void) const { return mBorderColor; }
+		inline void SetBorderColor(const Color& borderColor) { mBorderColor = borderColor; }
+
+		///
+		/// @details The size of the shape itself, the border is drawn around the outside of it.
+		///
+		inline virtual tbGraphics::PixelSpace GetPixelWidth(void) const override { return static_cast<tbGraphics::PixelSpace>(mSize.x); }
+		inline virtual tbGraphics::PixelSpace GetPixelHeight(void) const override { return static_cast<tbGraphics::PixelSpace>(mSize.y); }
+
+	protected:
+		enum class ShapeKind { RoundedBox, Arc };
+
+		SdfShape(const ShapeKind shapeKind, const Vector2& size, const Color& fillColor, const float border,
+			const Color& borderColor);
+
+		virtual void OnRender(void) const override;
+
+		inline const Vector2& GetShapeSize(void) const { return mSize; }
+
+		//Only read by the shader for ShapeKind::RoundedBox, see MakeCornerRadii().
+		Vector4 mCornerRadii;
+
+		//Only read by the shader for ShapeKind::Arc: start angle, sweep, thickness and outer radius.
+		Vector4 mArc;
+
+	private:
+		void RebuildQuad(void);
+
+		Vector2 mSize;
+		Color mBorderColor;
+		float mBorder;
+		ShapeKind mShapeKind;
+		mutable bool mWasRebuilt; //since last rendered.
+	};
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_SdfShape_hpp */
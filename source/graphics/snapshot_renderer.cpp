@@ -0,0 +1,194 @@
+///
+/// @file
+/// @details Draws the objects of a captured RenderSnapshot using the prototypes in the MeshLibrary, sorted by a
+///   RenderSortKey so objects sharing a shader, texture, blend and prototype are drawn back to back.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/snapshot_renderer.hpp"
+#include "../graphics/render_interpolation.hpp"
+#include "../graphics/asteroid_shape.hpp"
+#include "../shader_system/uniform_buffer.hpp" //For ShaderHandleToProgramID
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::Implementation::BuildSnapshotDrawOrder(const RenderSnapshot& snapshot, const MeshLibrary& meshLibrary,
+	std::vector<DrawKey>& drawKeys, std::vector<DrawKey>& scratch)
+{
+	const size_t objectCount = snapshot.GetRenderObjectCount();
+	drawKeys.resize(objectCount);
+	for (size_t objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+	{
+		const MeshId meshId = snapshot.mMeshes[objectIndex];
+		const RenderLayer layer = snapshot.mLayers[objectIndex];
+		const MeshState& meshState = meshLibrary.GetMeshState(meshId);
+
+		drawKeys[objectIndex].mSortKey = MakeRenderSortKey(PassOfLayer(layer), layer, meshState.mBlend,
+			ShaderSystem::Implementation::ShaderHandleToProgramID(meshState.mShader), meshState.mTextureKey,
+			meshLibrary.GetMeshKey(meshId));
+		drawKeys[objectIndex].mObjectIndex = static_cast<tbCore::uint32>(objectIndex);
+	}
+
+	const size_t unsortedStateChanges = CountStateChanges(drawKeys);
+
+	//Stable so objects with the same key keep the order they were written in, no flickering.
+	RadixSortDrawKeys(drawKeys, scratch);
+	return unsortedStateChanges;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::SnapshotRenderer& Asteroids::TheSnapshotRenderer(void)
+{
+	static SnapshotRenderer theSnapshotRenderer;
+	return theSnapshotRenderer;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::SnapshotRenderer::SnapshotRenderer(void) :
+	tbCore::Noncopyable(),
+	mDrawKeys(),
+	mSortScratch(),
+	mDrawTransforms(),
+	mLastFrameStats()
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::SnapshotRenderer::~SnapshotRenderer(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SnapshotRenderer::Render(const RenderSnapshot& snapshot)
+{
+	MeshLibrary& meshLibrary = TheMeshLibrary();
+
+	FrameStats frameStats;
+	frameStats.mUnsortedStateChanges = Implementation::BuildSnapshotDrawOrder(snapshot, meshLibrary, mDrawKeys, mSortScratch);
+	Implementation::InterpolateSnapshotTransforms(snapshot, mDrawTransforms);
+
+	const ShaderSystem::ShaderHandle originalShader = ShaderSystem::theShaderManager.GetCurrentShader();
+
+	MeshId previousMesh = 0;
+	tbGraphics::Graphic* mesh = nullptr;
+	for (size_t orderIndex = 0; orderIndex < mDrawKeys.size(); ++orderIndex)
+	{
+		const tbCore::uint32 objectIndex = mDrawKeys[orderIndex].mObjectIndex;
+		const RenderSortKey sortKey = mDrawKeys[orderIndex].mSortKey;
+		const MeshId meshId = snapshot.mMeshes[objectIndex];
+		if (0 == orderIndex || meshId != previousMesh)
+		{
+			mesh = meshLibrary.FindMesh(meshId);
+			previousMesh = meshId;
+			++frameStats.mMeshChanges;
+		}
+
+		if (nullptr == mesh)
+		{
+			++frameStats.mMissingMeshes;
+			continue;
+		}
+
+		const RenderSortKey previousKey = (0 == orderIndex) ? sortKey : mDrawKeys[orderIndex - 1].mSortKey;
+		if (0 == orderIndex || Implementation::ShaderOf(previousKey) != Implementation::ShaderOf(sortKey))
+		{
+			ShaderSystem::theShaderManager.BindShader(meshLibrary.GetMeshState(meshId).mShader);
+			++frameStats.mShaderBinds;
+		}
+		else
+		{
+			++frameStats.mSkippedStateChanges;
+		}
+
+		if (Implementation::TextureOf(previousKey) != Implementation::TextureOf(sortKey))
+		{
+			++frameStats.mTextureChanges;
+		}
+		if (Implementation::BlendOf(previousKey) != Implementation::BlendOf(sortKey))
+		{
+			++frameStats.mBlendChanges;
+		}
+
+		const RenderTransform& transform = mDrawTransforms[objectIndex];
+		mesh->SetPosition(transform.mPosition);
+		mesh->SetRotation(Angle::Radians(transform.mRotation));
+		mesh->SetColor(snapshot.mColors[objectIndex]);
+		mesh->Render();
+		++frameStats.mObjectsDrawn;
+	}
+
+	ShaderSystem::theShaderManager.BindShader(originalShader);
+	mLastFrameStats = frameStats;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class SnapshotDrawOrderTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		SnapshotDrawOrderTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::SnapshotDrawOrderTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			const RenderTransform transform{ Vector2(0.0f, 0.0f), 0.0f };
+			const MeshId smallAsteroid = MakeMeshId(MeshKind::Asteroid, 1);
+			const MeshId largeAsteroid = MakeMeshId(MeshKind::Asteroid, 8);
+			const MeshId laser = MakeMeshId(MeshKind::Laser);
+			const MeshId rocketShip = MakeMeshId(MeshKind::RocketShip);
+
+			//Added out of id order on purpose, the mesh key follows the order the library saw them in.
+			MeshLibrary meshLibrary;
+			meshLibrary.AddMesh(smallAsteroid, std::make_unique<AsteroidShape>(5, 16.0f));
+			meshLibrary.AddMesh(largeAsteroid, std::make_unique<AsteroidShape>(9, 64.0f));
+			meshLibrary.AddMesh(laser, std::make_unique<AsteroidShape>(3, 8.0f),
+				MeshState{ BlendMode::Alpha, ShaderSystem::InvalidShader(), MakeTextureKey("data/laser_sprites/01.png") });
+			meshLibrary.AddMesh(rocketShip, std::make_unique<AsteroidShape>(3, 48.0f));
+
+			RenderSnapshot snapshot;
+			snapshot.AddRenderObject(rocketShip, RenderLayer::Ships, transform, transform, tbGraphics::ColorPalette::White);
+			snapshot.AddRenderObject(largeAsteroid, RenderLayer::Asteroids, transform, transform, tbGraphics::ColorPalette::White);
+			snapshot.AddRenderObject(laser, RenderLayer::Asteroids, transform, transform, tbGraphics::ColorPalette::White);
+			snapshot.AddRenderObject(smallAsteroid, RenderLayer::Asteroids, transform, transform, tbGraphics::ColorPalette::White);
+			snapshot.AddRenderObject(largeAsteroid, RenderLayer::Asteroids, transform, transform, tbGraphics::ColorPalette::White);
+			snapshot.AddRenderObject(laser, RenderLayer::Asteroids, transform, transform, tbGraphics::ColorPalette::White);
+
+			std::vector<DrawKey> drawKeys;
+			std::vector<DrawKey> scratch;
+			const size_t unsortedStateChanges = Implementation::BuildSnapshotDrawOrder(snapshot, meshLibrary, drawKeys, scratch);
+
+			ExpectedValue(drawKeys.size(), size_t(6), "Expected every object in the draw order.");
+			ExpectedValue(drawKeys[0].mObjectIndex, tbCore::uint32(3), "Expected the first mesh on the lowest layer first.");
+			ExpectedValue(drawKeys[1].mObjectIndex, tbCore::uint32(1), "Expected matching meshes to be grouped, in written order.");
+			ExpectedValue(drawKeys[2].mObjectIndex, tbCore::uint32(4), "Expected matching meshes to be grouped, in written order.");
+			ExpectedValue(drawKeys[3].mObjectIndex, tbCore::uint32(2), "Expected the blended, textured mesh after the opaque shapes.");
+			ExpectedValue(drawKeys[4].mObjectIndex, tbCore::uint32(5), "Expected matching meshes to be grouped, in written order.");
+			ExpectedValue(drawKeys[5].mObjectIndex, tbCore::uint32(0), "Expected the ship layer to be drawn over the asteroids.");
+
+			ExpectedValue(unsortedStateChanges, size_t(6), "Expected the written order to swap blend and texture three times.");
+			ExpectedValue(Implementation::CountStateChanges(drawKeys), size_t(4), "Expected the sorted order to swap them twice.");
+
+			return true;
+		}
+	};
+
+	SnapshotDrawOrderTest theSnapshotDrawOrderTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,76 @@
+///
+/// @file
+/// @details Draws the objects of a captured RenderSnapshot using the prototypes in the MeshLibrary, sorted by a
+///   RenderSortKey so objects sharing a shader, texture, blend and prototype are drawn back to back.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_SnapshotRenderer_hpp
+#define Asteroids_SnapshotRenderer_hpp
+
+#include "../asteroids.hpp"
+#include "../graphics/render_snapshot.hpp"
+#include "../graphics/render_sort_key.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+
+#include <vector>
+
+namespace Asteroids
+{
+
+	namespace Implementation
+	{
+		///
+		/// @details Fills drawKeys with a sort key for each object in the snapshot, from its layer and the state of its
+		///   mesh in the library, then radix sorts them. The painters order between layers is kept while objects that
+		///   share state are drawn back to back. Returns the state changes drawing in the written order would cause.
+		///
+		size_t BuildSnapshotDrawOrder(const RenderSnapshot& snapshot, const MeshLibrary& meshLibrary,
+			std::vector<DrawKey>& drawKeys, std::vector<DrawKey>& scratch);
+	};
+
+	class SnapshotRenderer : public tbCore::Noncopyable
+	{
+	public:
+		struct FrameStats
+		{
+			size_t mObjectsDrawn = 0;
+			size_t mMeshChanges = 0;
+			size_t mMissingMeshes = 0;
+			size_t mShaderBinds = 0;
+			size_t mTextureChanges = 0;
+			size_t mBlendChanges = 0;
+			size_t mSkippedStateChanges = 0;
+
+			//The state changes that the written order would have caused, to compare against.
+			size_t mUnsortedStateChanges = 0;
+		};
+
+		SnapshotRenderer(void);
+		~SnapshotRenderer(void);
+
+		///
+		/// @details Works out the draw order and interpolated transforms, then draws every object in the snapshot, the
+		///   world pass and then the interface pass. The shader is only bound when the sort key says it changed, the
+		///   texture and blend are still set inside the TurtleBrains graphics so those changes are only counted.
+		///
+		void Render(const RenderSnapshot& snapshot);
+
+		inline const FrameStats& GetLastFrameStats(void) const { return mLastFrameStats; }
+
+	private:
+		// 2026-10-19: The sort and interpolation used to run on a worker thread, but Render() waited on it straight
+		//   away so nothing overlapped and each frame paid for the handoff. A few dozen records are cheaper inline.
+		std::vector<DrawKey> mDrawKeys;
+		std::vector<DrawKey> mSortScratch;
+		std::vector<RenderTransform> mDrawTransforms;
+		FrameStats mLastFrameStats;
+	};
+
+	SnapshotRenderer& TheSnapshotRenderer(void);
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_SnapshotRenderer_hpp */
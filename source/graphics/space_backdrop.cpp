@@ -0,0 +1,185 @@
+///
+/// @file
+/// @details Draws the parallax layers of space behind the game world in a single full screen pass, each layer sampled
+///   by the backdrop shader with its own offset rather than drawn as its own full screen sprite.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../graphics/space_backdrop.hpp"
+#include "../graphics/dynamic_resolution.hpp"
+#include "../shader_system/star_field_texture.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <cmath>
+
+namespace Asteroids::Implementation
+{
+	SpaceBackdrop::FrameStats theLastBackdropStats;
+
+	///
+	/// @details The scroll of a layer wrapped into a single tile of its texture, so the offset handed to the shader
+	///   stays small and keeps its precision however long the backdrop has been scrolling.
+	///
+	float WrapLayerOffset(const float scroll, const float parallax, const float tileSize)
+	{
+		const float offset = std::fmod(scroll * parallax, tileSize);
+		return (offset < 0.0f) ? offset + tileSize : offset;
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const Asteroids::SpaceBackdrop::FrameStats& Asteroids::SpaceBackdrop::GetLastFrameStats(void)
+{
+	return Implementation::theLastBackdropStats;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::SpaceBackdrop::SpaceBackdrop(const String& nebulaTextureFile) :
+	tbGraphics::Graphic(),
+	mBackdropBlock(),
+	mNebulaSprite(nebulaTextureFile),
+	mLayers(),
+	mTargetArea(Vector2::Zero()),
+	mScrollPosition(Vector2::Zero())
+{
+	mNebulaSprite.SetOrigin(Anchor::TopLeft);
+	mNebulaSprite.SetPosition(0.0f, 0.0f);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::SpaceBackdrop::~SpaceBackdrop(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SpaceBackdrop::ResetTargetArea(const float width, const float height)
+{
+	mTargetArea = Vector2(width, height);
+
+	//The nebula sprite is only the full screen quad the shader runs over; stretched to cover the area its UVs map
+	//  zero to one across the world, which the shader turns back into world pixels.
+	mNebulaSprite.SetScale(width / static_cast<float>(mNebulaSprite.GetPixelWidth()),
+		height / static_cast<float>(mNebulaSprite.GetPixelHeight()));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SpaceBackdrop::AddParallaxLayer(const BackdropTexture texture, const float parallax, const float opacity,
+	const float brightness, const float scale)
+{
+	tb_error_if(mLayers.size() >= kMaximumLayers, "SpaceBackdrop can hold at most %d layers.", static_cast<int>(kMaximumLayers));
+	tb_error_if(scale <= 0.0f, "SpaceBackdrop layers must have a positive scale.");
+	mLayers.push_back(Layer{ texture, parallax, opacity, brightness, scale });
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SpaceBackdrop::OnRender(void) const
+{
+	using namespace ShaderSystem;
+
+	tbGraphics::Graphic::OnRender();
+
+	if (true == mLayers.empty())
+	{
+		return;
+	}
+
+	WriteBackdropBlock();
+	BindStarFieldTexture();
+
+	theShaderManager.PushAndBindShader(theSpaceBackdropShader);
+	theShaderManager.ApplyUniformsForDraw();
+	mBackdropBlock.Bind(theSpaceBackdropShader);
+
+	mNebulaSprite.Render();
+
+	mBackdropBlock.Unbind();
+	theShaderManager.PopShader();
+
+	const IntVector2 renderSize = TheDynamicResolution().GetRenderSize();
+	FrameStats& frameStats = Implementation::theLastBackdropStats;
+	frameStats.mDrawCalls = 1;
+	frameStats.mLayerCount = mLayers.size();
+	frameStats.mPixelsShaded = static_cast<size_t>(renderSize.x) * static_cast<size_t>(renderSize.y);
+	frameStats.mLayerSamples = frameStats.mPixelsShaded * mLayers.size();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::SpaceBackdrop::WriteBackdropBlock(void) const
+{
+	const Vector2 nebulaSize(static_cast<float>(mNebulaSprite.GetPixelWidth()), static_cast<float>(mNebulaSprite.GetPixelHeight()));
+	const Vector2 starFieldSize(static_cast<float>(ShaderSystem::kStarFieldTextureSize), static_cast<float>(ShaderSystem::kStarFieldTextureSize));
+
+	//Unused layers are reset too, only the rows that differ from the last write are uploaded so that costs nothing.
+	ShaderSystem::SpaceBackdropBlock& block = mBackdropBlock.BeginWrite();
+	for (size_t layerIndex = 0; layerIndex < kMaximumLayers; ++layerIndex)
+	{
+		ShaderSystem::Std140::Vec4& layerTransform = block.mLayerTransforms[layerIndex];
+		ShaderSystem::Std140::Vec4& layerTint = block.mLayerTints[layerIndex];
+		if (layerIndex >= mLayers.size())
+		{
+			layerTransform = ShaderSystem::Std140::Vec4{ 0.0f, 0.0f, 1.0f, 0.0f };
+			layerTint = ShaderSystem::Std140::Vec4{ 0.0f, 0.0f, 0.0f, 0.0f };
+			continue;
+		}
+
+		const Layer& layer = mLayers[layerIndex];
+		const bool isStarField = (BackdropTexture::StarField == layer.mTexture);
+		const Vector2 tileSize = ((true == isStarField) ? starFieldSize : nebulaSize) * layer.mScale;
+
+		layerTransform.x = Implementation::WrapLayerOffset(mScrollPosition.x, layer.mParallax, tileSize.x);
+		layerTransform.y = Implementation::WrapLayerOffset(mScrollPosition.y, layer.mParallax, tileSize.y);
+		layerTransform.z = layer.mScale;
+		layerTransform.w = (true == isStarField) ? 1.0f : 0.0f;
+
+		const float tint = layer.mBrightness * layer.mOpacity;
+		layerTint = ShaderSystem::Std140::Vec4{ tint, tint, tint, layer.mOpacity };
+	}
+
+	block.mBackdrop = ShaderSystem::Std140::Vec4{ mTargetArea.x, mTargetArea.y, static_cast<float>(mLayers.size()), 0.0f };
+	mBackdropBlock.EndWrite();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class SpaceBackdropTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		SpaceBackdropTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::SpaceBackdropTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			const auto isNear = [](const float value, const float expected) { return std::fabs(value - expected) < 0.01f; };
+
+			ExpectedValue(isNear(Implementation::WrapLayerOffset(100.0f, 0.5f, 512.0f), 50.0f), true, "Expected the parallax to scale the scroll.");
+			ExpectedValue(isNear(Implementation::WrapLayerOffset(1100.0f, 1.0f, 512.0f), 76.0f), true, "Expected the offset to wrap into a single tile.");
+			ExpectedValue(isNear(Implementation::WrapLayerOffset(-100.0f, 1.0f, 512.0f), 412.0f), true, "Expected a negative scroll to wrap positive.");
+			ExpectedValue(isNear(Implementation::WrapLayerOffset(1.0e7f, 0.25f, 512.0f), std::fmod(2.5e6f, 512.0f)), true,
+				"Expected a long scroll to stay inside a tile.");
+
+			return true;
+		}
+	};
+
+	SpaceBackdropTest theSpaceBackdropTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,89 @@
+///
+/// @file
+/// @details Draws the parallax layers of space behind the game world in a single full screen pass, each layer sampled
+///   by the backdrop shader with its own offset rather than drawn as its own full screen sprite.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_SpaceBackdrop_hpp
+#define Asteroids_SpaceBackdrop_hpp
+
+#include "../asteroids.hpp"
+#include "../shader_system/shaders.hpp"
+#include "../shader_system/uniform_buffer.hpp"
+
+#include <turtle_brains/graphics/tb_sprite.hpp>
+
+#include <vector>
+
+namespace Asteroids
+{
+
+	enum class BackdropTexture { Nebula, StarField };
+
+	class SpaceBackdrop : public tbGraphics::Graphic
+	{
+	public:
+		//Must match the size of the arrays in ubSpaceBackdrop, space_backdrop_gl3_2.frag.
+		static const size_t kMaximumLayers = 4;
+
+		struct FrameStats
+		{
+			size_t mDrawCalls = 0;
+			size_t mLayerCount = 0;
+			size_t mPixelsShaded = 0;
+			size_t mLayerSamples = 0;
+		};
+
+		///
+		/// @details Stats from the most recent backdrop that was rendered, whichever scene it belonged to.
+		///
+		static const FrameStats& GetLastFrameStats(void);
+
+		explicit SpaceBackdrop(const String& nebulaTextureFile);
+		virtual ~SpaceBackdrop(void);
+
+		///
+		/// @details The world area covered by the backdrop, in world pixels.
+		///
+		void ResetTargetArea(const float width, const float height);
+
+		///
+		/// @details Layers are drawn in the order they were added, back to front. A parallax of 1 scrolls the layer
+		///   with the backdrop, 0 holds it still. Scale is how many world pixels each texel of the texture covers.
+		///
+		void AddParallaxLayer(const BackdropTexture texture, const float parallax, const float opacity,
+			const float brightness = 1.0f, const float scale = 1.0f);
+
+		inline const Vector2& GetScrollPosition(void) const { return mScrollPosition; }
+		inline void SetScrollPosition(const Vector2& scrollPosition) { mScrollPosition = scrollPosition; }
+
+		inline virtual tbGraphics::PixelSpace GetPixelWidth(void) const override { return static_cast<tbGraphics::PixelSpace>(mTargetArea.x); }
+		inline virtual tbGraphics::PixelSpace GetPixelHeight(void) const override { return static_cast<tbGraphics::PixelSpace>(mTargetArea.y); }
+
+	protected:
+		virtual void OnRender(void) const override;
+
+	private:
+		struct Layer
+		{
+			BackdropTexture mTexture;
+			float mParallax;
+			float mOpacity;
+			float mBrightness;
+			float mScale;
+		};
+
+		void WriteBackdropBlock(void) const;
+
+		mutable ShaderSystem::UniformBlock<ShaderSystem::SpaceBackdropBlock> mBackdropBlock;
+		tbGraphics::Sprite mNebulaSprite;
+		std::vector<Layer> mLayers;
+		Vector2 mTargetArea;
+		Vector2 mScrollPosition;
+	};
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_SpaceBackdrop_hpp */
@@ -6,6 +6,7 @@
 ///------------------------------------------------------------------------------------------------------------------///
 
 #include "interface.hpp"
+#include "interface/layout_tree.hpp"
 
 #if defined(rusty_development)
   #include "development/screen_resolution_tool.hpp"
@@ -17,31 +18,41 @@ namespace
 {
 	namespace FontSize
 	{
-		static const tbGraphics::FontSize HighRes = 128;
-		static const tbGraphics::FontSize Title = 52;
-		static const tbGraphics::FontSize Normal = 38;
-		static const tbGraphics::FontSize Small = 28;
+		static const float HighRes = 128.0f;
+		static const float Title = 52.0f;
+		static const float Normal = 38.0f;
+		static const float Small = 28.0f;
 	};
 };
 
-//--------------------------------------------------------------------------------------------------------------------//
-
-float Asteroids::Interface::Scale(void)
+namespace Asteroids::Interface::Implementation
 {
-	return static_cast<float>(tbGraphics::ScreenHeight()) / static_cast<float>(Interface::Height());
-}
+	InterfaceMetrics theInterfaceMetrics;
+	tbGraphics::PixelSpace theMetricsScreenWidth = 0;
+	tbGraphics::PixelSpace theMetricsScreenHeight = 0;
+	float theMetricsAspectRatio = 0.0f;
+	size_t theInterfaceRevision = 0;
+};
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-float Asteroids::Interface::AspectRatio(void)
+Asteroids::Interface::Implementation::InterfaceMetrics Asteroids::Interface::Implementation::ComputeInterfaceMetrics(
+	const float screenWidth, const float screenHeight, const float maximumAspectRatio)
 {
-	//return tbGraphics::ScreenAspectRatio();
-	return 1920.0f / 1080.0f;
+	InterfaceMetrics metrics;
+	metrics.mScale = screenHeight / static_cast<float>(Interface::Height());
+
+	const float scaledScreenWidth = screenWidth / metrics.mScale;
+	metrics.mTargetWidth = static_cast<tbGraphics::PixelSpace>(scaledScreenWidth);
+	metrics.mWidth = static_cast<tbGraphics::PixelSpace>(std::round(tbMath::Minimum<float>(scaledScreenWidth,
+		Interface::Height() * maximumAspectRatio)));
+	metrics.mPosition = Vector2((scaledScreenWidth - metrics.mWidth) / 2.0f, 0.0f);
+	return metrics;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-tbGraphics::PixelSpace Asteroids::Interface::Width(void)
+const Asteroids::Interface::Implementation::InterfaceMetrics& Asteroids::Interface::Implementation::GetInterfaceMetrics(void)
 {
 	// TODO: Asteroids: Settings: 2025-10-22: This maximumInterfaceAspectRatio should be something in the settings to
 	//   support very wide screens so that the player can adjust how wide the UI is. Maybe some want it on screen-edge.
@@ -56,9 +67,52 @@ tbGraphics::PixelSpace Asteroids::Interface::Width(void)
 	}
 #endif
 
-	const float scaledScreenWidth = tbGraphics::ScreenWidth() / Interface::Scale();
-	const float widthValue = tbMath::Minimum<float>(scaledScreenWidth, Interface::Height() * appliedMaximumRatio);
-	return static_cast<tbGraphics::PixelSpace>(std::round(widthValue));
+	// 2026-10-19: Scale(), Width() and the anchors used to be worked out from the window size on every call, and the
+	//   interface called them many times an update. Now they are only worked out again when the window size changes.
+	const tbGraphics::PixelSpace screenWidth = tbGraphics::ScreenWidth();
+	const tbGraphics::PixelSpace screenHeight = tbGraphics::ScreenHeight();
+	if (screenWidth != theMetricsScreenWidth || screenHeight != theMetricsScreenHeight ||
+		appliedMaximumRatio != theMetricsAspectRatio || 0 == theInterfaceRevision)
+	{
+		theMetricsScreenWidth = screenWidth;
+		theMetricsScreenHeight = screenHeight;
+		theMetricsAspectRatio = appliedMaximumRatio;
+		theInterfaceMetrics = ComputeInterfaceMetrics(static_cast<float>(screenWidth), static_cast<float>(screenHeight),
+			appliedMaximumRatio);
+		++theInterfaceRevision;
+	}
+
+	return theInterfaceMetrics;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::Interface::GetInterfaceRevision(void)
+{
+	Implementation::GetInterfaceMetrics();
+	return Implementation::theInterfaceRevision;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float Asteroids::Interface::Scale(void)
+{
+	return Implementation::GetInterfaceMetrics().mScale;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float Asteroids::Interface::AspectRatio(void)
+{
+	//return tbGraphics::ScreenAspectRatio();
+	return 1920.0f / 1080.0f;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbGraphics::PixelSpace Asteroids::Interface::Width(void)
+{
+	return Implementation::GetInterfaceMetrics().mWidth;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -79,7 +133,7 @@ Asteroids::Vector2 Asteroids::Interface::Size(void)
 
 tbGraphics::PixelSpace Asteroids::Interface::TargetWidth(void)
 {
-	return static_cast<tbGraphics::PixelSpace>(tbGraphics::ScreenWidth() / Interface::Scale());
+	return Implementation::GetInterfaceMetrics().mTargetWidth;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -108,24 +162,9 @@ tbMath::Vector2 Asteroids::Interface::GetAnchorPositionOfInterface(const tbGraph
 
 tbMath::Vector2 Asteroids::Interface::GetAnchorPositionOfInterface(const tbGraphics::AnchorLocation& anchor, const Vector2& offset)
 {
-	const float interfaceHeight = Interface::Height();
-	const float interfaceWidth = Interface::Width();
-	const Vector2 interfacePosition(((tbGraphics::ScreenWidth() / Scale()) - interfaceWidth) / 2.0f, 0.0f);
-
-	switch (anchor)
-	{
-	case Anchor::TopLeft:      return interfacePosition + offset;
-	case Anchor::TopCenter:    return interfacePosition + offset + tbMath::Vector2(0.5f * interfaceWidth, 0.0f * interfaceHeight);
-	case Anchor::TopRight:     return interfacePosition + offset + tbMath::Vector2(1.0f * interfaceWidth, 0.0f * interfaceHeight);
-	case Anchor::CenterLeft:   return interfacePosition + offset + tbMath::Vector2(0.0f * interfaceWidth, 0.5f * interfaceHeight);
-	case Anchor::Center:       return interfacePosition + offset + tbMath::Vector2(0.5f * interfaceWidth, 0.5f * interfaceHeight);
-	case Anchor::CenterRight:  return interfacePosition + offset + tbMath::Vector2(1.0f * interfaceWidth, 0.5f * interfaceHeight);
-	case Anchor::BottomLeft:   return interfacePosition + offset + tbMath::Vector2(0.0f * interfaceWidth, 1.0f * interfaceHeight);
-	case Anchor::BottomCenter: return interfacePosition + offset + tbMath::Vector2(0.5f * interfaceWidth, 1.0f * interfaceHeight);
-	case Anchor::BottomRight:  return interfacePosition + offset + tbMath::Vector2(1.0f * interfaceWidth, 1.0f * interfaceHeight);
-	};
-
-	return offset;
+	const Implementation::InterfaceMetrics& metrics = Implementation::GetInterfaceMetrics();
+	const LayoutRect interfaceRect{ metrics.mPosition, Vector2(static_cast<float>(metrics.mWidth), static_cast<float>(Height())) };
+	return Implementation::AnchorPoint(interfaceRect, anchor) + offset;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -188,37 +227,39 @@ tbGraphics::Sprite Asteroids::Interface::MakeIconSprite(const String& iconName,
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::Interface::MakeTitleText(tbGraphics::Text& textObject, const String& textString)
+void Asteroids::Interface::MakeTitleText(SdfText& textObject, const String& textString)
 {
-	textObject.SetText(textString, FontSize::Title, "data/font/comic_mono.ttf");
+	textObject.SetText(textString, FontSize::Title);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::Interface::MakeNormalText(tbGraphics::Text& textObject, const String& textString)
+void Asteroids::Interface::MakeNormalText(SdfText& textObject, const String& textString)
 {
-	textObject.SetText(textString, FontSize::Normal, "data/font/comic_mono.ttf");
+	textObject.SetText(textString, FontSize::Normal);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::Interface::MakeSmallText(tbGraphics::Text& textObject, const String& textString)
+void Asteroids::Interface::MakeSmallText(SdfText& textObject, const String& textString)
 {
-	textObject.SetText(textString, FontSize::Small, "data/font/comic_mono.ttf");
+	textObject.SetText(textString, FontSize::Small);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::Interface::MakeScalableText(tbGraphics::Text& textObject, const String& textString)
+void Asteroids::Interface::MakeScalableText(SdfText& textObject, const String& textString)
 {
 	MakeScalableText(&textObject, textString);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::Interface::MakeScalableText(tbGraphics::Text* const &textObject , const String& textString)
+void Asteroids::Interface::MakeScalableText(SdfText* const &textObject , const String& textString)
 {
-	textObject->SetText(textString, FontSize::HighRes, "data/font/comic_mono.ttf");
+	// 2026-10-19: This used to rasterize its own 128pt atlas to stay sharp when scaled down, the distance field is
+	//   sharp at any scale so this is only the size it has before being scaled to fit.
+	textObject->SetText(textString, FontSize::HighRes);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -10,6 +10,7 @@
 
 #include "asteroids.hpp"
 #include "game_manager.hpp"
+#include "interface/sdf_text.hpp"
 
 namespace Asteroids
 {
@@ -135,6 +136,30 @@ namespace Asteroids
 
 namespace Asteroids::Interface
 {
+	namespace Implementation
+	{
+		struct InterfaceMetrics
+		{
+			float mScale = 1.0f;
+			tbGraphics::PixelSpace mWidth = 0;
+			tbGraphics::PixelSpace mTargetWidth = 0;
+			Vector2 mPosition = Vector2::Zero(); //of the top-left corner, in interface space.
+		};
+
+		InterfaceMetrics ComputeInterfaceMetrics(const float screenWidth, const float screenHeight, const float maximumAspectRatio);
+
+		///
+		/// @details Only computed again when the window size changes, see GetInterfaceRevision().
+		///
+		const InterfaceMetrics& GetInterfaceMetrics(void);
+	};
+
+	///
+	/// @details Changes whenever the interface metrics change, so anything laid out from them, like a LayoutTree, can
+	///   tell it needs laying out again.
+	///
+	size_t GetInterfaceRevision(void);
+
 	float Scale(void);
 	float AspectRatio(void);
 
@@ -162,11 +187,14 @@ namespace Asteroids::Interface
 	tbGraphics::Sprite MakeIconSprite(const String& iconName, const float size = kIconSize);
 	tbGraphics::Sprite MakeStatIcon(const Stat& stat, const float size = kIconSize);
 
-	void MakeTitleText(tbGraphics::Text& textObject, const String& textString);
-	void MakeNormalText(tbGraphics::Text& textObject, const String& textString);
-	void MakeSmallText(tbGraphics::Text& textObject, const String& textString);
-	void MakeScalableText(tbGraphics::Text& textObject, const String& textString);
-	void MakeScalableText(tbGraphics::Text* const &textObject, const String& textString);
+	///
+	/// @details Every size is drawn from the one distance field atlas of comic_mono, see SdfText.
+	///
+	void MakeTitleText(SdfText& textObject, const String& textString);
+	void MakeNormalText(SdfText& textObject, const String& textString);
+	void MakeSmallText(SdfText& textObject, const String& textString);
+	void MakeScalableText(SdfText& textObject, const String& textString);
+	void MakeScalableText(SdfText* const &textObject, const String& textString);
 };	//namespace Asteroids
 
 #endif /* Asteroids_Interface_hpp */
@@ -0,0 +1,115 @@
+///
+/// @file
+/// @details Provide a dropdown selection box for the Asteroids settings screen.
+///
+/// <!-- Copyright (c) 2019-2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../interface/dropdown.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::Interface::Implementation::ClampFirstVisibleRow(const size_t firstRow, const size_t itemCount,
+	const size_t visibleRows)
+{
+	if (itemCount <= visibleRows)
+	{
+		return 0;
+	}
+
+	return std::min(firstRow, itemCount - visibleRows);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::Interface::Implementation::ScrollRowIntoView(const size_t firstRow, const size_t row,
+	const size_t itemCount, const size_t visibleRows)
+{
+	if (0 == visibleRows)
+	{
+		return 0;
+	}
+
+	size_t scrolledRow = firstRow;
+	if (row < firstRow)
+	{
+		scrolledRow = row;
+	}
+	else if (row >= firstRow + visibleRows)
+	{
+		scrolledRow = row - visibleRows + 1;
+	}
+
+	return ClampFirstVisibleRow(scrolledRow, itemCount, visibleRows);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::Interface::Implementation::ItemIndexOfRow(const size_t firstRow, const size_t visibleRow)
+{
+	return firstRow + visibleRow;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::int32 Asteroids::Interface::Implementation::ScrolledPointerOffset(const size_t firstRow,
+	const tbGraphics::PixelSpace& rowHeight)
+{
+	return static_cast<tbCore::int32>(firstRow) * static_cast<tbCore::int32>(rowHeight);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class DropdownScrollingTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		DropdownScrollingTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::DropdownScrollingTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace Interface::Implementation;
+
+			ExpectedValue(ClampFirstVisibleRow(3, 5, 8), size_t(0), "Expected a list that fits to never scroll.");
+			ExpectedValue(ClampFirstVisibleRow(495, 500, 8), size_t(492), "Expected the last page to stay full.");
+			ExpectedValue(ClampFirstVisibleRow(10, 500, 8), size_t(10), "Expected a row in range to be kept.");
+
+			ExpectedValue(ScrollRowIntoView(10, 12, 500, 8), size_t(10), "Expected a visible row not to scroll.");
+			ExpectedValue(ScrollRowIntoView(10, 4, 500, 8), size_t(4), "Expected a row above to become the first row.");
+			ExpectedValue(ScrollRowIntoView(10, 30, 500, 8), size_t(23), "Expected a row below to become the last row.");
+			ExpectedValue(ScrollRowIntoView(0, 499, 500, 8), size_t(492), "Expected the last item to show the last page.");
+
+			{	//Scroll with the wheel and then pick the fourth row seen, the way the base Dropdown hit tests it.
+				const tbGraphics::PixelSpace rowHeight = 60;
+				const size_t firstRow = ClampFirstVisibleRow(3 * 3, 500, 8); //three wheel steps down.
+				const tbCore::int32 pointerIntoList = 3 * 60 + 25;
+
+				const tbCore::int32 scrolledPointer = pointerIntoList + ScrolledPointerOffset(firstRow, rowHeight);
+				const size_t pickedItem = static_cast<size_t>(scrolledPointer / static_cast<tbCore::int32>(rowHeight));
+				ExpectedValue(pickedItem, ItemIndexOfRow(firstRow, 3), "Expected the row under the pointer to be picked.");
+				ExpectedValue(pickedItem, size_t(12), "Expected the item shown in the fourth row after scrolling nine.");
+				ExpectedValue(ScrollRowIntoView(firstRow, pickedItem, 500, 8), firstRow,
+					"Expected focusing the picked item to leave the list where it was scrolled.");
+
+				ExpectedValue(ScrolledPointerOffset(0, rowHeight), tbCore::int32(0), "Expected no offset before scrolling.");
+			}
+
+			return true;
+		}
+	};
+
+	DropdownScrollingTest theDropdownScrollingTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
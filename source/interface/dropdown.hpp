@@ -15,22 +15,65 @@
 #include <turtle_brains/express/interface/tbx_interface_dropdown.hpp>
 #include <turtle_brains/graphics/tb_basic_shapes.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace Asteroids::Interface
 {
 
+	namespace Implementation
+	{
+		///
+		/// @details The first row a list can be scrolled to while still filling every visible row, which is zero for a
+		///   list that fits without scrolling.
+		///
+		size_t ClampFirstVisibleRow(const size_t firstRow, const size_t itemCount, const size_t visibleRows);
+
+		///
+		/// @details The first visible row after scrolling the least amount needed to bring row into view.
+		///
+		size_t ScrollRowIntoView(const size_t firstRow, const size_t row, const size_t itemCount, const size_t visibleRows);
+
+		///
+		/// @details The item shown by a row of the opened list, rows counting from the top of the list as it is seen.
+		///
+		size_t ItemIndexOfRow(const size_t firstRow, const size_t visibleRow);
+
+		///
+		/// @details How far down the pointer is moved so a hit test that knows nothing of scrolling, taking the item as
+		///   the row under the pointer, lands on ItemIndexOfRow() instead.
+		///
+		tbCore::int32 ScrolledPointerOffset(const size_t firstRow, const tbGraphics::PixelSpace& rowHeight);
+	};
+
+	///
+	/// @details Only the rows that fit in the opened list exist as graphics, they are created once and recycled to
+	///   show whichever items are scrolled into view. Opening a list of hundreds of items costs the same as five.
+	///
 	class SimpleDropdown : public tbxInterface::Unstable::Dropdown
 	{
 	public:
+		static constexpr size_t kDefaultVisibleRows = 8;
+
 		SimpleDropdown(const ItemContainer& itemNames, const size_t selectedIndex,
-			const tbGraphics::PixelSpace& width, const tbGraphics::PixelSpace& height) :
+			const tbGraphics::PixelSpace& width, const tbGraphics::PixelSpace& height,
+			const size_t visibleRows = kDefaultVisibleRows) :
 
 			Dropdown(itemNames, selectedIndex),
 			mSelectedText(itemNames[selectedIndex]),
-			mDropdownBox(static_cast<float>(width), static_cast<float>(height* itemNames.size()), ColorPalette::DarkGray,
-				tbMath::Vector2(0.0f, 0.0f)),
+			mActivatedBox(static_cast<float>(width), static_cast<float>(height), ColorPalette::Green),
+			mDropdownBox(static_cast<float>(width), static_cast<float>(height * std::min(visibleRows, itemNames.size())),
+				ColorPalette::DarkGray, tbMath::Vector2(0.0f, 0.0f)),
 			mFocusedItemBox(static_cast<float>(width), static_cast<float>(height), ColorPalette::LightGray,
-				tbMath::Vector2(0.0f, static_cast<float>(height* selectedIndex)))
+				tbMath::Vector2(0.0f, 0.0f)),
+			mScrollThumb(kScrollThumbWidth, static_cast<float>(height), ColorPalette::LightGray),
+			mRowLabels(std::min(visibleRows, itemNames.size())),
+			mRowItems(mRowLabels.size(), kNoItem),
+			mFirstVisibleRow(0),
+			mLastFocusedIndex(kNoItem)
 		{
+			tb_error_if(0 == visibleRows, "SimpleDropdown needs room to show at least one item.");
+
 			const float floatWidth = static_cast<float>(width);
 			const float floatHeight = static_cast<float>(height);
 
@@ -54,53 +97,155 @@ namespace Asteroids::Interface
 
 			SetPixelSize(width, height);
 
-			RecreateActiveGraphics(selectedIndex);
+			// 2026-10-19: The opened list used to be cleared and every item given a new Text on each open or selection
+			//   change. Now the opened list is built once from the pooled rows and only their text, color and the
+			//   boxes positions change as it scrolls.
+			mDropdownBox.SetDepth(1.0f);
+			mFocusedItemBox.SetDepth(1.0f);
+			AddGraphic(State::Activated, mActivatedBox);
+			AddGraphic(State::Activated, mDropdownBox);
+			AddGraphic(State::Activated, mFocusedItemBox);
+
+			for (size_t rowIndex = 0; rowIndex < mRowLabels.size(); ++rowIndex)
+			{
+				tbGraphics::Text& rowLabel = mRowLabels[rowIndex];
+				rowLabel.SetDepth(1.0f);
+				AddGraphic(State::Activated, rowLabel);
+			}
+
+			if (itemNames.size() > mRowLabels.size())
+			{
+				mScrollThumb.SetScale(1.0f, static_cast<float>(mRowLabels.size() * mRowLabels.size()) / static_cast<float>(itemNames.size()));
+				mScrollThumb.SetDepth(1.0f);
+				AddGraphic(State::Activated, mScrollThumb);
+			}
+
+			ScrollTo(Implementation::ScrollRowIntoView(0, selectedIndex, itemNames.size(), mRowLabels.size()));
 		}
 
 		virtual ~SimpleDropdown(void)
 		{
 		}
 
+		///
+		/// @details Call once an update while the dropdown is in an interface. Scrolls the opened list with the mouse
+		///   wheel and page up or down, and keeps the focused item in view as the keyboard moves it.
+		///
+		void UpdateScrolling(void)
+		{
+			if (State::Activated != GetState())
+			{
+				return;
+			}
+
+			const size_t pageRows = mRowLabels.size();
+			size_t firstRow = mFirstVisibleRow;
+			if (true == tbGame::Input::IsKeyPressed(tbApplication::tbMouseScrollUp))
+			{
+				firstRow = (firstRow > kRowsPerWheelStep) ? firstRow - kRowsPerWheelStep : 0;
+			}
+			if (true == tbGame::Input::IsKeyPressed(tbApplication::tbMouseScrollDown))
+			{
+				firstRow += kRowsPerWheelStep;
+			}
+			if (true == tbGame::Input::IsKeyPressed(tbApplication::tbKeyPageUp))
+			{
+				firstRow = (firstRow > pageRows) ? firstRow - pageRows : 0;
+			}
+			if (true == tbGame::Input::IsKeyPressed(tbApplication::tbKeyPageDown))
+			{
+				firstRow += pageRows;
+			}
+
+			if (GetFocusedIndex() != mLastFocusedIndex)
+			{
+				firstRow = Implementation::ScrollRowIntoView(firstRow, GetFocusedIndex(), GetItemNames().size(), pageRows);
+			}
+
+			ScrollTo(firstRow);
+		}
+
+		inline size_t GetFirstVisibleRow(void) const { return mFirstVisibleRow; }
+		inline size_t GetVisibleRowCount(void) const { return mRowLabels.size(); }
+
 	protected:
-		virtual void OnSelectionChange(const size_t selectedIndex) override
+		///
+		/// @details The base Dropdown hovers, focuses and picks the item under the pointer by counting rows from the top
+		///   of the list, which only matches what is shown before the list scrolls. While opened and scrolled it is given
+		///   a controller with the pointer moved down by the scrolled rows so the row under the pointer is what it picks.
+		///
+		virtual void OnUpdate(const tbxInterface::Unstable::Controller& controller) override
 		{
-			RecreateActiveGraphics(selectedIndex);
+			if (State::Activated != GetState() || 0 == mFirstVisibleRow)
+			{
+				Dropdown::OnUpdate(controller);
+				return;
+			}
+
+			const tbxInterface::Unstable::Point interfaceOffset = controller.GetInterfaceOffset();
+			tbxInterface::Unstable::Controller scrolledController(controller);
+			scrolledController.SetInterfaceOffset(tbxInterface::Unstable::Point(interfaceOffset.x, interfaceOffset.y -
+				Implementation::ScrolledPointerOffset(mFirstVisibleRow, GetPixelHeight())));
+			Dropdown::OnUpdate(scrolledController);
 		}
 
-	private:
-		inline void RecreateActiveGraphics(const size_t selectedIndex)
+		virtual void OnSelectionChange(const size_t selectedIndex) override
 		{
-			ClearGraphics(State::Activated);
+			mSelectedText.SetText(GetItemNames().at(selectedIndex));
+			mSelectedText.SetOrigin(Anchor::CenterLeft);
+			mSelectedText.SetPosition(10.0f, GetPixelHeight() * 0.5f);
 
-			AddGraphic(State::Activated, new tbGraphics::BoxShape(static_cast<float>(GetPixelWidth()),
-				static_cast<float>(GetPixelHeight()), tbGraphics::ColorPalette::Green));
+			ScrollTo(Implementation::ScrollRowIntoView(mFirstVisibleRow, selectedIndex, GetItemNames().size(), mRowLabels.size()), true);
+		}
 
-			mDropdownBox.SetDepth(1.0f);
-			AddGraphic(State::Activated, mDropdownBox);
+	private:
+		static constexpr size_t kNoItem = static_cast<size_t>(-1);
+		static constexpr size_t kRowsPerWheelStep = 3;
+		static constexpr float kScrollThumbWidth = 8.0f;
+
+		///
+		/// @details Nothing is touched unless the list scrolled, focus moved or the selection changed. Even then a
+		///   row only sets its text when the item it shows changes, colors and positions are cheap to set.
+		///
+		void ScrollTo(const size_t firstRow, const bool selectionChanged = false)
+		{
+			const size_t clampedRow = Implementation::ClampFirstVisibleRow(firstRow, GetItemNames().size(), mRowLabels.size());
+			if (clampedRow != mFirstVisibleRow || GetFocusedIndex() != mLastFocusedIndex || true == selectionChanged)
+			{
+				mFirstVisibleRow = clampedRow;
+				RefreshVisibleRows();
+			}
+		}
 
-			mFocusedItemBox.SetPosition(0.0f, static_cast<float>(GetPixelHeight() * GetFocusedIndex()));
-			mFocusedItemBox.SetDepth(1.0f);
-			AddGraphic(State::Activated, mFocusedItemBox);
+		void RefreshVisibleRows(void)
+		{
+			const float rowHeight = static_cast<float>(GetPixelHeight());
+			const ItemContainer& itemNames = GetItemNames();
 
-			size_t currentIndex = 0;
-			for (const tbCore::String& item : GetItemNames())
+			for (size_t rowIndex = 0; rowIndex < mRowLabels.size(); ++rowIndex)
 			{
-				tbGraphics::Text* itemLabel = new tbGraphics::Text(item);
-				itemLabel->SetOrigin(Anchor::CenterLeft);
-				itemLabel->SetPosition(10.0f, GetPixelHeight() * (static_cast<float>(currentIndex) + 0.5f));
-				if (currentIndex == GetSelectedIndex())
+				const size_t itemIndex = Implementation::ItemIndexOfRow(mFirstVisibleRow, rowIndex);
+				tbGraphics::Text& rowLabel = mRowLabels[rowIndex];
+				if (itemIndex != mRowItems[rowIndex])
 				{
-					itemLabel->SetColor(ColorPalette::Blue);
+					rowLabel.SetText(itemNames[itemIndex]);
+					rowLabel.SetOrigin(Anchor::CenterLeft);
+					rowLabel.SetPosition(10.0f, rowHeight * (static_cast<float>(rowIndex) + 0.5f));
+					mRowItems[rowIndex] = itemIndex;
 				}
 
-				itemLabel->SetDepth(1.0f);
-				AddGraphic(State::Activated, itemLabel);
-				++currentIndex;
+				rowLabel.SetColor((itemIndex == GetSelectedIndex()) ? ColorPalette::Blue : ColorPalette::White);
 			}
 
-			mSelectedText.SetText(GetItemNames().at(selectedIndex)),
-				mSelectedText.SetOrigin(Anchor::CenterLeft);
-			mSelectedText.SetPosition(10.0f, GetPixelHeight() * 0.5f);
+			//The focused item may be scrolled out of view, the box goes with it and is simply not seen.
+			const float focusedRow = static_cast<float>(GetFocusedIndex()) - static_cast<float>(mFirstVisibleRow);
+			mFocusedItemBox.SetVisible(focusedRow >= 0.0f && focusedRow < static_cast<float>(mRowLabels.size()));
+			mFocusedItemBox.SetPosition(0.0f, rowHeight * focusedRow);
+
+			mScrollThumb.SetPosition(static_cast<float>(GetPixelWidth()) - kScrollThumbWidth, rowHeight *
+				static_cast<float>(mRowLabels.size() * mFirstVisibleRow) / static_cast<float>(itemNames.size()));
+
+			mLastFocusedIndex = GetFocusedIndex();
 		}
 
 		class TriangleShape : public tbGraphics::PolygonShape
@@ -121,8 +266,14 @@ namespace Asteroids::Interface
 
 		tbGraphics::Text mSelectedText; //When closed
 
+		tbGraphics::BoxShape mActivatedBox;
 		tbGraphics::BoxShape mDropdownBox;
 		tbGraphics::BoxShape mFocusedItemBox;
+		tbGraphics::BoxShape mScrollThumb;
+		std::vector<tbGraphics::Text> mRowLabels; //pooled, one for each visible row; never resized after construction.
+		std::vector<size_t> mRowItems;            //the item each row label currently shows.
+		size_t mFirstVisibleRow;
+		size_t mLastFocusedIndex;
 	};
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,71 @@
+///
+/// @file
+/// @details A piece of interface text bound to a couple of values, like the level or experience in the HUD, that is
+///   only laid out again when one of those values changes.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../interface/hud_label.hpp"
+
+namespace Asteroids::Interface::Implementation
+{
+	size_t theHudLabelLayouts = 0;
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::Interface::HudLabel::GetLayoutCount(void)
+{
+	return Implementation::theHudLabelLayouts;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::HudLabel::HudLabel(const TextStyle style, const Formatter& formatter) :
+	tbGraphics::Graphic(),
+	mText(),
+	mFormatter(formatter),
+	mStyle(style),
+	mValue(0),
+	mSecondValue(0),
+	mHasValues(false)
+{
+	tb_error_if(nullptr == mFormatter, "HudLabel expects a formatter to build its text.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::HudLabel::~HudLabel(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::HudLabel::SetValues(const int value, const int secondValue)
+{
+	if (true == mHasValues && value == mValue && secondValue == mSecondValue)
+	{
+		return;
+	}
+
+	mValue = value;
+	mSecondValue = secondValue;
+	mHasValues = true;
+
+	//The cache holds the laid out text, a value that comes back, like after a scene reopens, skips the layout.
+	mText = TheTextCache().GetText(mStyle, mFormatter(mValue, mSecondValue));
+	mText.SetOrigin(Anchor::TopLeft);
+	mText.SetPosition(0.0f, 0.0f);
+	++Implementation::theHudLabelLayouts;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::HudLabel::OnRender(void) const
+{
+	tbGraphics::Graphic::OnRender();
+	mText.Render();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
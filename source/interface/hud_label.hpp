@@ -0,0 +1,59 @@
+///
+/// @file
+/// @details A piece of interface text bound to a couple of values, like the level or experience in the HUD, that is
+///   only laid out again when one of those values changes.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_HudLabel_hpp
+#define Asteroids_HudLabel_hpp
+
+#include "../asteroids.hpp"
+#include "../interface/text_cache.hpp"
+
+#include <functional>
+
+namespace Asteroids::Interface
+{
+
+	class HudLabel : public tbGraphics::Graphic
+	{
+	public:
+		///
+		/// @details Builds the string for the bound values, only called when one of them changed.
+		///
+		using Formatter = std::function<String(const int value, const int secondValue)>;
+
+		HudLabel(const TextStyle style, const Formatter& formatter);
+		virtual ~HudLabel(void);
+
+		///
+		/// @details Safe to call every frame, nothing is formatted or laid out unless a value is different from the
+		///   last call.
+		///
+		void SetValues(const int value, const int secondValue = 0);
+
+		///
+		/// @details The number of times any label has been laid out, in a steady HUD it stops counting.
+		///
+		static size_t GetLayoutCount(void);
+
+		inline virtual tbGraphics::PixelSpace GetPixelWidth(void) const override { return mText.GetPixelWidth(); }
+		inline virtual tbGraphics::PixelSpace GetPixelHeight(void) const override { return mText.GetPixelHeight(); }
+
+	protected:
+		virtual void OnRender(void) const override;
+
+	private:
+		SdfText mText;
+		Formatter mFormatter;
+		TextStyle mStyle;
+		int mValue;
+		int mSecondValue;
+		bool mHasValues;
+	};
+
+};	//namespace Asteroids::Interface
+
+#endif /* Asteroids_HudLabel_hpp */
@@ -0,0 +1,508 @@
+///
+/// @file
+/// @details A retained tree of anchored and stacked containers that places interface graphics once when the window
+///   resizes or their content changes size, instead of every element repositioning itself every update.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../interface/layout_tree.hpp"
+#include "../interface.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Asteroids::Interface::Implementation
+{
+	//About the size of a button, so most cells hold only one or two elements.
+	const float kHitTestCellSize = 128.0f;
+
+	float AlignmentFraction(const StackAlignment alignment)
+	{
+		switch (alignment)
+		{
+		case StackAlignment::Start: return 0.0f;
+		case StackAlignment::Center: return 0.5f;
+		case StackAlignment::End: return 1.0f;
+		};
+
+		return 0.0f;
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Asteroids::Interface::LayoutRect::Contains(const Vector2& point) const
+{
+	return point.x >= mPosition.x && point.y >= mPosition.y &&
+		point.x < mPosition.x + mSize.x && point.y < mPosition.y + mSize.y;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Vector2 Asteroids::Interface::Implementation::AnchorPoint(const LayoutRect& rect, const tbGraphics::AnchorLocation& anchor)
+{
+	const float width = rect.mSize.x;
+	const float height = rect.mSize.y;
+
+	switch (anchor)
+	{
+	case Anchor::TopLeft:      return rect.mPosition;
+	case Anchor::TopCenter:    return rect.mPosition + Vector2(0.5f * width, 0.0f * height);
+	case Anchor::TopRight:     return rect.mPosition + Vector2(1.0f * width, 0.0f * height);
+	case Anchor::CenterLeft:   return rect.mPosition + Vector2(0.0f * width, 0.5f * height);
+	case Anchor::Center:       return rect.mPosition + Vector2(0.5f * width, 0.5f * height);
+	case Anchor::CenterRight:  return rect.mPosition + Vector2(1.0f * width, 0.5f * height);
+	case Anchor::BottomLeft:   return rect.mPosition + Vector2(0.0f * width, 1.0f * height);
+	case Anchor::BottomCenter: return rect.mPosition + Vector2(0.5f * width, 1.0f * height);
+	case Anchor::BottomRight:  return rect.mPosition + Vector2(1.0f * width, 1.0f * height);
+	};
+
+	return rect.mPosition;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::Implementation::HitTestGrid::HitTestGrid(const float cellSize) :
+	mEntries(),
+	mCells(),
+	mCellSize(cellSize)
+{
+	tb_error_if(cellSize <= 0.0f, "HitTestGrid expects cells with some size.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::Implementation::HitTestGrid::Clear(void)
+{
+	mEntries.clear();
+	mCells.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::Implementation::HitTestGrid::Insert(const size_t value, const LayoutRect& rect)
+{
+	const size_t entryIndex = mEntries.size();
+	mEntries.push_back(Entry{ value, rect });
+
+	const int lastCellX = CellOf(rect.mPosition.x + rect.mSize.x);
+	const int lastCellY = CellOf(rect.mPosition.y + rect.mSize.y);
+	for (int cellY = CellOf(rect.mPosition.y); cellY <= lastCellY; ++cellY)
+	{
+		for (int cellX = CellOf(rect.mPosition.x); cellX <= lastCellX; ++cellX)
+		{
+			mCells[CellKey(cellX, cellY)].push_back(entryIndex);
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::Interface::Implementation::HitTestGrid::FindAt(const Vector2& point,
+	const std::function<bool(size_t)>& isAccepted) const
+{
+	const auto cellIterator = mCells.find(CellKey(CellOf(point.x), CellOf(point.y)));
+	if (mCells.end() == cellIterator)
+	{
+		return kNothing;
+	}
+
+	//Walk backwards so the last inserted, the top-most, is found first.
+	const std::vector<size_t>& entryIndices = cellIterator->second;
+	for (auto indexIterator = entryIndices.rbegin(); indexIterator != entryIndices.rend(); ++indexIterator)
+	{
+		const Entry& entry = mEntries[*indexIterator];
+		if (true == entry.mRect.Contains(point) && (nullptr == isAccepted || true == isAccepted(entry.mValue)))
+		{
+			return entry.mValue;
+		}
+	}
+
+	return kNothing;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::int64 Asteroids::Interface::Implementation::HitTestGrid::CellKey(const int cellX, const int cellY) const
+{
+	return (static_cast<tbCore::int64>(cellX) << 32) ^ static_cast<tbCore::int64>(static_cast<tbCore::uint32>(cellY));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+int Asteroids::Interface::Implementation::HitTestGrid::CellOf(const float position) const
+{
+	return static_cast<int>(std::floor(position / mCellSize));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::LayoutTree::LayoutTree(void) :
+	mNodes(),
+	mHitTestGrid(Implementation::kHitTestCellSize),
+	mHoveredGraphic(nullptr),
+	mHoverPosition(Vector2::Zero()),
+	mInterfaceRevision(0),
+	mLayoutCount(0),
+	mIsDirty(true),
+	mIsHoverStale(true)
+{
+	Node root;
+	root.mKind = NodeKind::Anchored;
+	root.mParent = kInvalidLayoutNode;
+	root.mGraphic = nullptr;
+	root.mAnchor = Anchor::TopLeft;
+	root.mOrigin = Anchor::TopLeft;
+	root.mOffset = Vector2::Zero();
+	root.mDirection = StackDirection::Vertical;
+	root.mAlignment = StackAlignment::Start;
+	root.mSpacing = 0.0f;
+	root.mPadding = 0.0f;
+	root.mIsHitTestable = false;
+	root.mWasVisible = false;
+	root.mGraphicSize = Vector2::Zero();
+	mNodes.push_back(root);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::LayoutTree::~LayoutTree(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::LayoutNodeId Asteroids::Interface::LayoutTree::AddNode(const Node& node)
+{
+	tb_error_if(node.mParent >= mNodes.size(), "LayoutTree expected the parent node to exist.");
+	tb_error_if(NodeKind::Graphic == mNodes[node.mParent].mKind, "LayoutTree cannot add children to a graphic node.");
+
+	const LayoutNodeId nodeId = mNodes.size();
+	mNodes.push_back(node);
+	mNodes[node.mParent].mChildren.push_back(nodeId);
+	mIsDirty = true;
+	return nodeId;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::LayoutNodeId Asteroids::Interface::LayoutTree::AddAnchored(const tbGraphics::AnchorLocation& anchor,
+	const Vector2& offset, const tbGraphics::AnchorLocation& origin, const LayoutNodeId parent)
+{
+	Node node = mNodes[kRootLayoutNode];
+	node.mChildren.clear();
+	node.mParent = parent;
+	node.mAnchor = anchor;
+	node.mOrigin = origin;
+	node.mOffset = offset;
+	return AddNode(node);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::LayoutNodeId Asteroids::Interface::LayoutTree::AddStack(const StackDirection direction,
+	const float spacing, const StackAlignment alignment, const LayoutNodeId parent)
+{
+	Node node = mNodes[kRootLayoutNode];
+	node.mChildren.clear();
+	node.mKind = NodeKind::Stack;
+	node.mParent = parent;
+	node.mDirection = direction;
+	node.mAlignment = alignment;
+	node.mSpacing = spacing;
+	return AddNode(node);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::LayoutNodeId Asteroids::Interface::LayoutTree::AddGraphic(tbGraphics::Graphic& graphic,
+	const LayoutNodeId parent, const bool isHitTestable)
+{
+	Node node = mNodes[kRootLayoutNode];
+	node.mChildren.clear();
+	node.mKind = NodeKind::Graphic;
+	node.mParent = parent;
+	node.mGraphic = &graphic;
+	node.mIsHitTestable = isHitTestable;
+	return AddNode(node);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::LayoutTree::SetPadding(const LayoutNodeId node, const float padding)
+{
+	tb_error_if(node >= mNodes.size(), "LayoutTree expected the node to exist.");
+	if (padding != mNodes[node].mPadding)
+	{
+		mNodes[node].mPadding = padding;
+		mIsDirty = true;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const Asteroids::Interface::LayoutRect& Asteroids::Interface::LayoutTree::GetRect(const LayoutNodeId node) const
+{
+	tb_error_if(node >= mNodes.size(), "LayoutTree expected the node to exist.");
+	return mNodes[node].mRect;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Vector2 Asteroids::Interface::LayoutTree::MeasureGraphic(const Node& node) const
+{
+	return Vector2(std::fabs(node.mGraphic->GetWidth()), std::fabs(node.mGraphic->GetHeight()));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::LayoutTree::Update(void)
+{
+	bool needsLayout = mIsDirty;
+
+	const size_t interfaceRevision = Interface::GetInterfaceRevision();
+	if (interfaceRevision != mInterfaceRevision)
+	{
+		mInterfaceRevision = interfaceRevision;
+		needsLayout = true;
+	}
+
+	//Reading the size of each graphic is cheap, it is laying everything out that is only done when one changed.
+	for (Node& node : mNodes)
+	{
+		if (NodeKind::Graphic == node.mKind)
+		{
+			const Vector2 graphicSize = MeasureGraphic(node);
+			if (graphicSize != node.mGraphicSize)
+			{
+				node.mGraphicSize = graphicSize;
+				needsLayout = true;
+			}
+		}
+	}
+
+	if (true == needsLayout)
+	{
+		Layout();
+		mIsDirty = false;
+		mIsHoverStale = true;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::LayoutTree::Layout(void)
+{
+	//Measure from the leaves up, children always come after their parent.
+	for (size_t nodeIndex = mNodes.size(); nodeIndex > 0; --nodeIndex)
+	{
+		Node& node = mNodes[nodeIndex - 1];
+		Vector2 contentSize = Vector2::Zero();
+
+		if (NodeKind::Graphic == node.mKind)
+		{
+			contentSize = node.mGraphicSize;
+		}
+		else if (NodeKind::Stack == node.mKind)
+		{
+			const bool isHorizontal = (StackDirection::Horizontal == node.mDirection);
+			for (const LayoutNodeId childId : node.mChildren)
+			{
+				const Vector2& childSize = mNodes[childId].mRect.mSize;
+				if (true == isHorizontal)
+				{
+					contentSize.x += childSize.x;
+					contentSize.y = std::max(contentSize.y, childSize.y);
+				}
+				else
+				{
+					contentSize.x = std::max(contentSize.x, childSize.x);
+					contentSize.y += childSize.y;
+				}
+			}
+
+			const float totalSpacing = (true == node.mChildren.empty()) ? 0.0f : node.mSpacing * (node.mChildren.size() - 1);
+			if (true == isHorizontal)
+			{
+				contentSize.x += totalSpacing;
+			}
+			else
+			{
+				contentSize.y += totalSpacing;
+			}
+		}
+		else
+		{
+			for (const LayoutNodeId childId : node.mChildren)
+			{
+				contentSize.x = std::max(contentSize.x, mNodes[childId].mRect.mSize.x);
+				contentSize.y = std::max(contentSize.y, mNodes[childId].mRect.mSize.y);
+			}
+		}
+
+		node.mRect.mSize = contentSize + Vector2(node.mPadding, node.mPadding) * 2.0f;
+	}
+
+	//The root is the whole interface, so anchoring to it is the same as GetAnchorPositionOfInterface().
+	Node& root = mNodes[kRootLayoutNode];
+	root.mRect.mPosition = Interface::GetAnchorPositionOfInterface(Anchor::TopLeft);
+	root.mRect.mSize = Interface::Size();
+
+	//Then place from the root down, each parent positions its children.
+	mHitTestGrid.Clear();
+	for (Node& node : mNodes)
+	{
+		const LayoutRect contentRect{ node.mRect.mPosition + Vector2(node.mPadding, node.mPadding),
+			node.mRect.mSize - Vector2(node.mPadding, node.mPadding) * 2.0f };
+
+		if (NodeKind::Graphic == node.mKind)
+		{
+			node.mGraphic->SetOrigin(Anchor::TopLeft);
+			node.mGraphic->SetPosition(contentRect.mPosition);
+			if (true == node.mIsHitTestable)
+			{
+				mHitTestGrid.Insert(static_cast<size_t>(&node - mNodes.data()), contentRect);
+			}
+		}
+		else if (NodeKind::Stack == node.mKind)
+		{
+			const bool isHorizontal = (StackDirection::Horizontal == node.mDirection);
+			const float alignment = Implementation::AlignmentFraction(node.mAlignment);
+			float along = 0.0f;
+
+			for (const LayoutNodeId childId : node.mChildren)
+			{
+				LayoutRect& childRect = mNodes[childId].mRect;
+				if (true == isHorizontal)
+				{
+					childRect.mPosition = contentRect.mPosition + Vector2(along, (contentRect.mSize.y - childRect.mSize.y) * alignment);
+					along += childRect.mSize.x + node.mSpacing;
+				}
+				else
+				{
+					childRect.mPosition = contentRect.mPosition + Vector2((contentRect.mSize.x - childRect.mSize.x) * alignment, along);
+					along += childRect.mSize.y + node.mSpacing;
+				}
+			}
+		}
+		else
+		{
+			for (const LayoutNodeId childId : node.mChildren)
+			{
+				Node& child = mNodes[childId];
+				if (NodeKind::Anchored == child.mKind)
+				{
+					const LayoutRect childAtZero{ Vector2::Zero(), child.mRect.mSize };
+					child.mRect.mPosition = Implementation::AnchorPoint(contentRect, child.mAnchor) + child.mOffset -
+						Implementation::AnchorPoint(childAtZero, child.mOrigin);
+				}
+				else
+				{
+					child.mRect.mPosition = contentRect.mPosition;
+				}
+			}
+		}
+	}
+
+	++mLayoutCount;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::LayoutTree::UpdateHover(const Vector2& interfacePosition)
+{
+	//A graphic shown or hidden under a still mouse changes what is hovered just like the mouse moving would.
+	for (Node& node : mNodes)
+	{
+		if (true == node.mIsHitTestable && node.mGraphic->IsVisible() != node.mWasVisible)
+		{
+			node.mWasVisible = node.mGraphic->IsVisible();
+			mIsHoverStale = true;
+		}
+	}
+
+	if (false == mIsHoverStale && interfacePosition == mHoverPosition)
+	{
+		return;
+	}
+
+	mHoverPosition = interfacePosition;
+	mIsHoverStale = false;
+
+	const size_t hoveredNode = mHitTestGrid.FindAt(interfacePosition, [this](const size_t nodeId) {
+		return mNodes[nodeId].mGraphic->IsVisible();
+	});
+
+	mHoveredGraphic = (Implementation::HitTestGrid::kNothing == hoveredNode) ? nullptr : mNodes[hoveredNode].mGraphic;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Asteroids::Interface::LayoutTree::IsHovered(const tbGraphics::Graphic& graphic) const
+{
+	return &graphic == mHoveredGraphic;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class LayoutTreeTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		LayoutTreeTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::LayoutTreeTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace Interface;
+			using namespace Interface::Implementation;
+
+			const LayoutRect rect{ Vector2(100.0f, 50.0f), Vector2(200.0f, 80.0f) };
+			ExpectedValue(AnchorPoint(rect, Anchor::TopLeft) == Vector2(100.0f, 50.0f), true, "Expected the top-left corner.");
+			ExpectedValue(AnchorPoint(rect, Anchor::Center) == Vector2(200.0f, 90.0f), true, "Expected the center.");
+			ExpectedValue(AnchorPoint(rect, Anchor::BottomRight) == Vector2(300.0f, 130.0f), true, "Expected the bottom-right corner.");
+
+			const InterfaceMetrics sixteenByNine = ComputeInterfaceMetrics(1920.0f, 1080.0f, 16.0f / 9.0f);
+			ExpectedValue(sixteenByNine.mWidth, tbGraphics::PixelSpace(1920), "Expected the full width at 1080p.");
+			ExpectedValue(sixteenByNine.mPosition.x, 0.0f, "Expected no margin at 1080p.");
+
+			const InterfaceMetrics ultraWide = ComputeInterfaceMetrics(2560.0f, 1080.0f, 16.0f / 9.0f);
+			ExpectedValue(ultraWide.mWidth, tbGraphics::PixelSpace(1920), "Expected the width limited by the aspect ratio.");
+			ExpectedValue(ultraWide.mPosition.x, 320.0f, "Expected the interface centered on a wide screen.");
+			ExpectedValue(ultraWide.mTargetWidth, tbGraphics::PixelSpace(2560), "Expected the target to cover the screen.");
+
+			HitTestGrid grid(128.0f);
+			grid.Insert(1, LayoutRect{ Vector2(0.0f, 0.0f), Vector2(300.0f, 120.0f) });
+			grid.Insert(2, LayoutRect{ Vector2(200.0f, 100.0f), Vector2(100.0f, 100.0f) });
+			grid.Insert(3, LayoutRect{ Vector2(1000.0f, 1000.0f), Vector2(64.0f, 64.0f) });
+			ExpectedValue(grid.FindAt(Vector2(10.0f, 10.0f)), size_t(1), "Expected the only rectangle under the point.");
+			ExpectedValue(grid.FindAt(Vector2(250.0f, 110.0f)), size_t(2), "Expected the top-most of overlapping rectangles.");
+			ExpectedValue(grid.FindAt(Vector2(250.0f, 110.0f), [](const size_t value) { return 2 != value; }), size_t(1),
+				"Expected a rejected rectangle to reveal the one below.");
+			ExpectedValue(grid.FindAt(Vector2(600.0f, 600.0f)), HitTestGrid::kNothing, "Expected nothing in an empty cell.");
+			ExpectedValue(grid.FindAt(Vector2(1030.0f, 1030.0f)), size_t(3), "Expected a far away rectangle to be found.");
+			ExpectedValue(grid.FindAt(Vector2(-5.0f, 10.0f)), HitTestGrid::kNothing, "Expected nothing left of the screen.");
+
+			return true;
+		}
+	};
+
+	LayoutTreeTest theLayoutTreeTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,166 @@
+///
+/// @file
+/// @details A retained tree of anchored and stacked containers that places interface graphics once when the window
+///   resizes or their content changes size, instead of every element repositioning itself every update.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_LayoutTree_hpp
+#define Asteroids_LayoutTree_hpp
+
+#include "../asteroids.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace Asteroids::Interface
+{
+
+	using LayoutNodeId = size_t;
+	constexpr LayoutNodeId kRootLayoutNode = 0;
+	constexpr LayoutNodeId kInvalidLayoutNode = static_cast<LayoutNodeId>(-1);
+
+	enum class StackDirection { Horizontal, Vertical };
+	enum class StackAlignment { Start, Center, End }; //across the direction of the stack.
+
+	struct LayoutRect
+	{
+		Vector2 mPosition = Vector2::Zero(); //top-left in interface space.
+		Vector2 mSize = Vector2::Zero();
+
+		bool Contains(const Vector2& point) const;
+	};
+
+	namespace Implementation
+	{
+		///
+		/// @details The point of a rectangle at the anchor, like GetAnchorPositionOfInterface() for the interface.
+		///
+		Vector2 AnchorPoint(const LayoutRect& rect, const tbGraphics::AnchorLocation& anchor);
+
+		///
+		/// @details Buckets rectangles into square cells so a point only tests the few rectangles sharing its cell,
+		///   not every element in the interface. Later insertions are on top of earlier ones.
+		///
+		class HitTestGrid
+		{
+		public:
+			static constexpr size_t kNothing = static_cast<size_t>(-1);
+
+			explicit HitTestGrid(const float cellSize);
+
+			void Clear(void);
+			void Insert(const size_t value, const LayoutRect& rect);
+
+			///
+			/// @details The value of the top-most rectangle containing the point that isAccepted, or kNothing.
+			///
+			size_t FindAt(const Vector2& point, const std::function<bool(size_t)>& isAccepted = nullptr) const;
+
+		private:
+			tbCore::int64 CellKey(const int cellX, const int cellY) const;
+			int CellOf(const float position) const;
+
+			struct Entry
+			{
+				size_t mValue;
+				LayoutRect mRect;
+			};
+
+			std::vector<Entry> mEntries;
+			std::unordered_map<tbCore::int64, std::vector<size_t>> mCells; //indices into mEntries, in insertion order.
+			float mCellSize;
+		};
+	};
+
+	class LayoutTree : public tbCore::Noncopyable
+	{
+	public:
+		LayoutTree(void);
+		~LayoutTree(void);
+
+		///
+		/// @details A container whose origin is placed at the anchor of its parent plus the offset. The root is the
+		///   whole interface, so a node anchored TopRight of the root sits in the top-right corner of the interface.
+		///
+		LayoutNodeId AddAnchored(const tbGraphics::AnchorLocation& anchor, const Vector2& offset,
+			const tbGraphics::AnchorLocation& origin, const LayoutNodeId parent = kRootLayoutNode);
+
+		///
+		/// @details A container that lines its children up one after another with spacing between them.
+		///
+		LayoutNodeId AddStack(const StackDirection direction, const float spacing, const StackAlignment alignment,
+			const LayoutNodeId parent);
+
+		///
+		/// @details Places the graphic, which must outlive the tree, with its origin at its top-left. A hit testable
+		///   graphic can be found under the mouse with IsHovered().
+		///
+		LayoutNodeId AddGraphic(tbGraphics::Graphic& graphic, const LayoutNodeId parent, const bool isHitTestable = false);
+
+		void SetPadding(const LayoutNodeId node, const float padding);
+
+		///
+		/// @details Only lays the tree out again when the interface resized, a graphic changed size or the tree was
+		///   marked dirty; otherwise positions stay where they were and nothing is set.
+		///
+		void Update(void);
+		inline void MarkDirty(void) { mIsDirty = true; }
+
+		///
+		/// @details Finds the top-most visible hit testable graphic at the position, once for the whole interface, and
+		///   only when the position moved or the tree changed since the last time it looked.
+		///
+		void UpdateHover(const Vector2& interfacePosition);
+		bool IsHovered(const tbGraphics::Graphic& graphic) const;
+
+		const LayoutRect& GetRect(const LayoutNodeId node) const;
+
+		///
+		/// @details The number of times the tree has been laid out, in a steady interface it stops counting.
+		///
+		inline size_t GetLayoutCount(void) const { return mLayoutCount; }
+
+	private:
+		enum class NodeKind { Anchored, Stack, Graphic };
+
+		struct Node
+		{
+			NodeKind mKind;
+			LayoutNodeId mParent;
+			std::vector<LayoutNodeId> mChildren;
+			tbGraphics::Graphic* mGraphic;
+			tbGraphics::AnchorLocation mAnchor;
+			tbGraphics::AnchorLocation mOrigin;
+			Vector2 mOffset;
+			StackDirection mDirection;
+			StackAlignment mAlignment;
+			float mSpacing;
+			float mPadding;
+			bool mIsHitTestable;
+			bool mWasVisible; //as of the last hover test.
+			Vector2 mGraphicSize; //as of the last layout, a change means the tree needs laying out again.
+			LayoutRect mRect;
+		};
+
+		LayoutNodeId AddNode(const Node& node);
+		Vector2 MeasureGraphic(const Node& node) const;
+		void Layout(void);
+
+		std::vector<Node> mNodes; //a parent always comes before its children.
+		Implementation::HitTestGrid mHitTestGrid;
+		const tbGraphics::Graphic* mHoveredGraphic;
+		Vector2 mHoverPosition;
+		size_t mInterfaceRevision;
+		size_t mLayoutCount;
+		bool mIsDirty;
+		bool mIsHoverStale;
+	};
+
+};	//namespace Asteroids::Interface
+
+#endif /* Asteroids_LayoutTree_hpp */
@@ -0,0 +1,478 @@
+///
+/// @file
+/// @details Bakes comic_mono into a single signed distance field atlas the first time the game runs, caches it in the
+///   save directory, and keeps it on a texture unit so interface text of every size is drawn from the same glyphs.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../interface/sdf_font.hpp"
+#include "../graphics/render_target_pool.hpp"
+#include "../shader_system/gl_state_cache.hpp"
+
+// 2026-10-19: Baking draws each glyph with TurtleBrains into a RenderTarget and reads it back, which needs BeginDraw()
+//   to set up the view of the target, the same as the world target in BaseRustyScene.
+#define TurtleBrains_LetMeHave_Implementation
+#include <turtle_brains/graphics/implementation/tbi_renderer.hpp>
+#undef TurtleBrains_LetMeHave_Implementation
+
+#include <turtle_brains/core/tb_file_utilities.hpp>
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace Asteroids::Interface::Implementation
+{
+	GLuint theSdfFontTexture = 0;
+	SdfFontMetrics theSdfFontMetrics;
+	std::vector<tbCore::uint8> theSdfFontPixels;
+
+	//Bump whenever the bake changes so an old cache is baked again instead of drawing stale glyphs.
+	const tbCore::int64 kSdfFontCacheVersion = 1;
+
+	const String kSdfFontFile = "data/font/comic_mono.ttf";
+	const String kSdfFontCacheFile = "font_cache_comic_mono.sdf";
+
+	//Glyphs are drawn at the size of the old scalable text and downsampled into the atlas at half that.
+	const tbGraphics::FontSize kBakePointSize = 128;
+	const int kBakeDownsample = 2;
+	const int kBakePadding = 16; //in bake pixels, so 8 texels of the atlas.
+	const int kAtlasColumns = 16;
+
+	//The vector from a pixel to the nearest seed pixel, see ComputeDistanceField().
+	struct NearestOffset
+	{
+		int x;
+		int y;
+
+		inline int LengthSquared(void) const { return x * x + y * y; }
+	};
+
+	//Far enough to be outside any glyph cell, small enough that squaring it never overflows.
+	const NearestOffset kNoSeed = { 10000, 10000 };
+
+	void PropagateNearestOffsets(std::vector<NearestOffset>& offsets, const int width, const int height);
+	std::vector<NearestOffset> FindNearestSeeds(const std::vector<tbCore::uint8>& coverage, const int width,
+		const int height, const bool seedsAreInside);
+
+	void BakeSdfFont(SdfFontMetrics& metrics, std::vector<tbCore::uint8>& pixels);
+
+	inline int RoundUpTo(const int value, const int multiple) { return ((value + multiple - 1) / multiple) * multiple; }
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::Implementation::PropagateNearestOffsets(std::vector<NearestOffset>& offsets,
+	const int width, const int height)
+{
+	//Eight-point sequential Euclidean distance transform; two sweeps each carry the nearest seed a pixel further.
+	const auto compare = [&offsets, width, height](NearestOffset& offset, const int x, const int y, const int dx, const int dy) {
+		const int neighborX = x + dx;
+		const int neighborY = y + dy;
+		if (neighborX < 0 || neighborY < 0 || neighborX >= width || neighborY >= height)
+		{
+			return;
+		}
+
+		NearestOffset candidate = offsets[neighborY * width + neighborX];
+		candidate.x += dx;
+		candidate.y += dy;
+		if (candidate.LengthSquared() < offset.LengthSquared())
+		{
+			offset = candidate;
+		}
+	};
+
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			NearestOffset& offset = offsets[y * width + x];
+			compare(offset, x, y, -1, 0);
+			compare(offset, x, y, 0, -1);
+			compare(offset, x, y, -1, -1);
+			compare(offset, x, y, 1, -1);
+		}
+
+		for (int x = width - 1; x >= 0; --x)
+		{
+			compare(offsets[y * width + x], x, y, 1, 0);
+		}
+	}
+
+	for (int y = height - 1; y >= 0; --y)
+	{
+		for (int x = width - 1; x >= 0; --x)
+		{
+			NearestOffset& offset = offsets[y * width + x];
+			compare(offset, x, y, 1, 0);
+			compare(offset, x, y, 0, 1);
+			compare(offset, x, y, -1, 1);
+			compare(offset, x, y, 1, 1);
+		}
+
+		for (int x = 0; x < width; ++x)
+		{
+			compare(offsets[y * width + x], x, y, -1, 0);
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+std::vector<Asteroids::Interface::Implementation::NearestOffset> Asteroids::Interface::Implementation::FindNearestSeeds(
+	const std::vector<tbCore::uint8>& coverage, const int width, const int height, const bool seedsAreInside)
+{
+	std::vector<NearestOffset> offsets(coverage.size(), kNoSeed);
+	for (size_t pixelIndex = 0; pixelIndex < coverage.size(); ++pixelIndex)
+	{
+		if ((coverage[pixelIndex] >= 128) == seedsAreInside)
+		{
+			offsets[pixelIndex] = NearestOffset{ 0, 0 };
+		}
+	}
+
+	PropagateNearestOffsets(offsets, width, height);
+	return offsets;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+std::vector<tbCore::uint8> Asteroids::Interface::Implementation::ComputeDistanceField(
+	const std::vector<tbCore::uint8>& coverage, const int width, const int height, const float spread)
+{
+	tb_error_if(coverage.size() != static_cast<size_t>(width * height), "Expected the coverage to be width by height pixels.");
+	tb_error_if(spread <= 0.0f, "Expected the distance field to spread at least some distance from the edge.");
+
+	const std::vector<NearestOffset> toInside = FindNearestSeeds(coverage, width, height, true);
+	const std::vector<NearestOffset> toOutside = FindNearestSeeds(coverage, width, height, false);
+
+	std::vector<tbCore::uint8> field(coverage.size(), 0);
+	for (size_t pixelIndex = 0; pixelIndex < coverage.size(); ++pixelIndex)
+	{
+		//The distances are between pixel centers, the edge itself is halfway between an inside and outside pixel.
+		const bool isInside = (coverage[pixelIndex] >= 128);
+		const NearestOffset& nearest = (true == isInside) ? toOutside[pixelIndex] : toInside[pixelIndex];
+		const float edgeDistance = std::sqrt(static_cast<float>(nearest.LengthSquared())) - 0.5f;
+		const float signedDistance = (true == isInside) ? edgeDistance : -edgeDistance;
+
+		const float value = std::clamp(0.5f + signedDistance / (2.0f * spread), 0.0f, 1.0f);
+		field[pixelIndex] = static_cast<tbCore::uint8>(std::lround(value * 255.0f));
+	}
+
+	return field;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+std::vector<tbCore::uint8> Asteroids::Interface::Implementation::DownsampleField(const std::vector<tbCore::uint8>& field,
+	const int width, const int height, const int factor)
+{
+	tb_error_if(factor < 1 || 0 != width % factor || 0 != height % factor, "Expected the field to divide evenly by the factor.");
+
+	const int smallWidth = width / factor;
+	const int smallHeight = height / factor;
+	const int texelsPerBlock = factor * factor;
+
+	std::vector<tbCore::uint8> downsampled(static_cast<size_t>(smallWidth * smallHeight), 0);
+	for (int y = 0; y < smallHeight; ++y)
+	{
+		for (int x = 0; x < smallWidth; ++x)
+		{
+			int total = 0;
+			for (int blockY = 0; blockY < factor; ++blockY)
+			{
+				for (int blockX = 0; blockX < factor; ++blockX)
+				{
+					total += field[(y * factor + blockY) * width + (x * factor + blockX)];
+				}
+			}
+
+			downsampled[y * smallWidth + x] = static_cast<tbCore::uint8>((total + texelsPerBlock / 2) / texelsPerBlock);
+		}
+	}
+
+	return downsampled;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Asteroids::Interface::Implementation::LoadSdfFontCache(const String& filepath, SdfFontMetrics& metrics,
+	std::vector<tbCore::uint8>& pixels)
+{
+	std::ifstream inputFile(filepath, std::ios::binary);
+	if (false == inputFile.is_open())
+	{
+		return false;
+	}
+
+	if (kSdfFontCacheVersion != tbCore::FileUtilities::ReadVariableLengthEncoding(inputFile))
+	{
+		return false;
+	}
+
+	SdfFontMetrics loaded;
+	for (int* value : { &loaded.mAtlasPointSize, &loaded.mAdvance, &loaded.mLineHeight, &loaded.mCellWidth,
+		&loaded.mCellHeight, &loaded.mPadding, &loaded.mColumns, &loaded.mAtlasWidth, &loaded.mAtlasHeight })
+	{
+		*value = static_cast<int>(tbCore::FileUtilities::ReadVariableLengthEncoding(inputFile));
+	}
+
+	if (loaded.mAtlasWidth <= 0 || loaded.mAtlasHeight <= 0 || loaded.mColumns <= 0 || loaded.mAtlasPointSize <= 0)
+	{
+		return false;
+	}
+
+	std::vector<tbCore::uint8> loadedPixels(static_cast<size_t>(loaded.mAtlasWidth * loaded.mAtlasHeight), 0);
+	inputFile.read(reinterpret_cast<char*>(loadedPixels.data()), static_cast<std::streamsize>(loadedPixels.size()));
+	if (false == inputFile.good())
+	{
+		return false;
+	}
+
+	metrics = loaded;
+	pixels.swap(loadedPixels);
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::Implementation::SaveSdfFontCache(const String& filepath, const SdfFontMetrics& metrics,
+	const std::vector<tbCore::uint8>& pixels)
+{
+	std::ofstream outputFile(filepath, std::ios::binary);
+	if (false == outputFile.is_open())
+	{
+		tb_always_log(LogGame::Warning() << "Failed to save the font cache, it will be baked again next time.");
+		return;
+	}
+
+	tbCore::FileUtilities::WriteVariableLengthEncoding(kSdfFontCacheVersion, outputFile);
+	for (const int value : { metrics.mAtlasPointSize, metrics.mAdvance, metrics.mLineHeight, metrics.mCellWidth,
+		metrics.mCellHeight, metrics.mPadding, metrics.mColumns, metrics.mAtlasWidth, metrics.mAtlasHeight })
+	{
+		tbCore::FileUtilities::WriteVariableLengthEncoding(static_cast<tbCore::int64>(value), outputFile);
+	}
+
+	outputFile.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::Implementation::BakeSdfFont(SdfFontMetrics& metrics, std::vector<tbCore::uint8>& pixels)
+{
+	tbGraphics::Text measureText;
+	measureText.SetText("M", kBakePointSize, kSdfFontFile);
+	const int bakeAdvance = static_cast<int>(measureText.GetPixelWidth());
+	const int bakeLineHeight = static_cast<int>(measureText.GetPixelHeight());
+	const int bakeCellWidth = RoundUpTo(bakeAdvance + kBakePadding * 2, kBakeDownsample);
+	const int bakeCellHeight = RoundUpTo(bakeLineHeight + kBakePadding * 2, kBakeDownsample);
+
+	const int glyphCount = kSdfFontLastGlyph - kSdfFontFirstGlyph + 1;
+	const int rowCount = (glyphCount + kAtlasColumns - 1) / kAtlasColumns;
+
+	metrics.mAtlasPointSize = kBakePointSize / kBakeDownsample;
+	metrics.mAdvance = bakeAdvance / kBakeDownsample;
+	metrics.mLineHeight = bakeLineHeight / kBakeDownsample;
+	metrics.mCellWidth = bakeCellWidth / kBakeDownsample;
+	metrics.mCellHeight = bakeCellHeight / kBakeDownsample;
+	metrics.mPadding = kBakePadding / kBakeDownsample;
+	metrics.mColumns = kAtlasColumns;
+	metrics.mAtlasWidth = metrics.mCellWidth * kAtlasColumns;
+	metrics.mAtlasHeight = metrics.mCellHeight * rowCount;
+
+	pixels.assign(static_cast<size_t>(metrics.mAtlasWidth * metrics.mAtlasHeight), 0);
+
+	tbGraphics::RenderTarget& bakeTarget = TheRenderTargetPool().Acquire(bakeCellWidth, bakeCellHeight);
+	std::vector<tbCore::uint8> bakePixels(static_cast<size_t>(bakeCellWidth * bakeCellHeight * 4), 0);
+	std::vector<tbCore::uint8> coverage(static_cast<size_t>(bakeCellWidth * bakeCellHeight), 0);
+
+	for (int glyphIndex = 0; glyphIndex < glyphCount; ++glyphIndex)
+	{
+		tbGraphics::Text glyphText;
+		glyphText.SetText(String(1, static_cast<char>(kSdfFontFirstGlyph + glyphIndex)), kBakePointSize, kSdfFontFile);
+		glyphText.SetColor(ColorPalette::White);
+		glyphText.SetPosition(static_cast<float>(kBakePadding), static_cast<float>(kBakePadding));
+
+		bakeTarget.BindRenderTarget();
+		bakeTarget.ClearRenderTarget(ColorPalette::Black);
+		tbGraphics::Implementation::Renderer::BeginDraw();
+		glyphText.Render();
+
+		//White on opaque black leaves the coverage in the red channel whatever the blending. The rows come back in
+		//  TurtleBrains pixel space order since the target was drawn from the bottom-left, see BaseRustyScene::OnRender().
+		tb_check_gl_errors(glReadPixels(0, 0, bakeCellWidth, bakeCellHeight, GL_RGBA, GL_UNSIGNED_BYTE, bakePixels.data()));
+		bakeTarget.UnbindRenderTarget();
+
+		for (size_t pixelIndex = 0; pixelIndex < coverage.size(); ++pixelIndex)
+		{
+			coverage[pixelIndex] = bakePixels[pixelIndex * 4];
+		}
+
+		const std::vector<tbCore::uint8> cellField = DownsampleField(ComputeDistanceField(coverage, bakeCellWidth,
+			bakeCellHeight, static_cast<float>(kBakePadding)), bakeCellWidth, bakeCellHeight, kBakeDownsample);
+
+		const int cellLeft = (glyphIndex % kAtlasColumns) * metrics.mCellWidth;
+		const int cellTop = (glyphIndex / kAtlasColumns) * metrics.mCellHeight;
+		for (int y = 0; y < metrics.mCellHeight; ++y)
+		{
+			std::copy_n(cellField.begin() + y * metrics.mCellWidth, metrics.mCellWidth,
+				pixels.begin() + (cellTop + y) * metrics.mAtlasWidth + cellLeft);
+		}
+	}
+
+	TheRenderTargetPool().Release(bakeTarget);
+
+	//Give the window its own view back and forget whatever the glyphs bound behind the cache.
+	tbGraphics::Implementation::Renderer::BeginDraw();
+	ShaderSystem::TheGLStateCache().Invalidate();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::CreateSdfFontTexture(void)
+{
+	using namespace Implementation;
+	tb_error_if(0 != theSdfFontTexture, "Calling CreateSdfFontTexture() with the font texture already existing.");
+
+	if (true == theSdfFontPixels.empty())
+	{
+		const String cacheFilepath = GetSaveDirectory() + kSdfFontCacheFile;
+		if (false == LoadSdfFontCache(cacheFilepath, theSdfFontMetrics, theSdfFontPixels))
+		{
+			BakeSdfFont(theSdfFontMetrics, theSdfFontPixels);
+			SaveSdfFontCache(cacheFilepath, theSdfFontMetrics, theSdfFontPixels);
+		}
+	}
+
+	ShaderSystem::GLStateCache& stateCache = ShaderSystem::TheGLStateCache();
+
+	tb_check_gl_errors(glGenTextures(1, &theSdfFontTexture));
+	stateCache.BindTexture(kSdfFontTextureUnit, GL_TEXTURE_2D, theSdfFontTexture);
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+
+	//A single channel atlas rows are rarely a multiple of four bytes.
+	tb_check_gl_errors(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+	tb_check_gl_errors(glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, static_cast<GLsizei>(theSdfFontMetrics.mAtlasWidth),
+		static_cast<GLsizei>(theSdfFontMetrics.mAtlasHeight), 0, GL_RED, GL_UNSIGNED_BYTE, theSdfFontPixels.data()));
+	tb_check_gl_errors(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
+	stateCache.BindTexture(kSdfFontTextureUnit, GL_TEXTURE_2D, 0);
+	stateCache.SetActiveTextureUnit(0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::DestroySdfFontTexture(void)
+{
+	using namespace Implementation;
+	if (0 != theSdfFontTexture)
+	{
+		tb_check_gl_errors(glDeleteTextures(1, &theSdfFontTexture));
+		theSdfFontTexture = 0;
+	}
+
+	ShaderSystem::TheGLStateCache().Invalidate();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::BindSdfFontTexture(void)
+{
+	tb_error_if(0 == Implementation::theSdfFontTexture, "Expected the font texture to be created before binding it.");
+
+	ShaderSystem::GLStateCache& stateCache = ShaderSystem::TheGLStateCache();
+	stateCache.BindTexture(kSdfFontTextureUnit, GL_TEXTURE_2D, Implementation::theSdfFontTexture);
+	stateCache.SetActiveTextureUnit(0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Asteroids::Interface::IsSdfFontBaked(void)
+{
+	return false == Implementation::theSdfFontPixels.empty();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const Asteroids::Interface::SdfFontMetrics& Asteroids::Interface::GetSdfFontMetrics(void)
+{
+	tb_error_if(false == IsSdfFontBaked(), "Expected the font atlas to be baked before laying out text with it.");
+	return Implementation::theSdfFontMetrics;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool Asteroids::Interface::Implementation::IsInSdfFontAtlas(const String& text)
+{
+	return std::all_of(text.begin(), text.end(), [](const char character) {
+		return '\n' == character || (character >= kSdfFontFirstGlyph && character <= kSdfFontLastGlyph);
+	});
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class SdfFontTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		SdfFontTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::SdfFontTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace Interface::Implementation;
+
+			//A 6x6 square in the middle of a 16x16 image.
+			const int size = 16;
+			std::vector<tbCore::uint8> coverage(size * size, 0);
+			for (int y = 5; y < 11; ++y)
+			{
+				for (int x = 5; x < 11; ++x)
+				{
+					coverage[y * size + x] = 255;
+				}
+			}
+
+			const std::vector<tbCore::uint8> field = ComputeDistanceField(coverage, size, size, 4.0f);
+			ExpectedValue(field.size(), coverage.size(), "Expected a field the size of the coverage.");
+			ExpectedValue(field[7 * size + 7] > field[5 * size + 7], true, "Expected the middle deeper inside than the edge.");
+			ExpectedValue(field[5 * size + 7] >= 128, true, "Expected an edge pixel inside to stay above the middle value.");
+			ExpectedValue(field[4 * size + 7] < 128, true, "Expected a pixel just outside below the middle value.");
+			ExpectedValue(field[0], tbCore::uint8(0), "Expected a pixel past the spread to be fully outside.");
+			ExpectedValue(field[5 * size + 7], field[10 * size + 7], "Expected opposite edges of the square to match.");
+
+			const std::vector<tbCore::uint8> empty = ComputeDistanceField(std::vector<tbCore::uint8>(16, 0), 4, 4, 4.0f);
+			ExpectedValue(std::all_of(empty.begin(), empty.end(), [](const tbCore::uint8 value) { return 0 == value; }), true,
+				"Expected an empty glyph to be outside everywhere.");
+
+			const std::vector<tbCore::uint8> downsampled = DownsampleField({ 0, 255, 10, 20, 255, 0, 30, 40 }, 4, 2, 2);
+			ExpectedValue(downsampled.size(), size_t(2), "Expected a texel for each 2x2 block.");
+			ExpectedValue(downsampled[0], tbCore::uint8(128), "Expected the block to be averaged and rounded.");
+			ExpectedValue(downsampled[1], tbCore::uint8(25), "Expected the second block averaged on its own.");
+
+			ExpectedValue(IsInSdfFontAtlas("Level 12\nXP: 3/40 ~"), true, "Expected printable ascii and newlines in the atlas.");
+			ExpectedValue(IsInSdfFontAtlas("Niveau sup\xC3\xA9rieur"), false, "Expected a UTF-8 accent to be outside the atlas.");
+			ExpectedValue(IsInSdfFontAtlas("tab\there"), false, "Expected a control character to be outside the atlas.");
+
+			return true;
+		}
+	};
+
+	SdfFontTest theSdfFontTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
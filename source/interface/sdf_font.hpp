@@ -0,0 +1,86 @@
+///
+/// @file
+/// @details Bakes comic_mono into a single signed distance field atlas the first time the game runs, caches it in the
+///   save directory, and keeps it on a texture unit so interface text of every size is drawn from the same glyphs.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_SdfFont_hpp
+#define Asteroids_SdfFont_hpp
+
+#include "../asteroids.hpp"
+
+#include <vector>
+
+namespace Asteroids::Interface
+{
+
+	const size_t kSdfFontTextureUnit = 3;
+
+	//Printable ascii. SdfText draws a string with anything else, such as a localized string in UTF-8, with the
+	//  TurtleBrains text instead; kSdfFontMissingGlyph is only a last resort inside the atlas.
+	const char kSdfFontFirstGlyph = ' ';
+	const char kSdfFontLastGlyph = '~';
+	const char kSdfFontMissingGlyph = '?';
+
+	///
+	/// @details Everything is in pixels of the atlas, which holds the glyphs at mAtlasPointSize. Scale by the point size
+	///   of the text over mAtlasPointSize to lay out text of any size.
+	///
+	struct SdfFontMetrics
+	{
+		int mAtlasPointSize = 0;
+		int mAdvance = 0;      //comic_mono is monospaced, every glyph moves the pen this far.
+		int mLineHeight = 0;
+		int mCellWidth = 0;    //each glyph has a cell of the atlas with mPadding on every side of it.
+		int mCellHeight = 0;
+		int mPadding = 0;      //also how far the distance field reaches from the edge of a glyph.
+		int mColumns = 0;
+		int mAtlasWidth = 0;
+		int mAtlasHeight = 0;
+	};
+
+	namespace Implementation
+	{
+		///
+		/// @details Turns the coverage of a glyph, 8 bits per pixel, into a distance field of the same size. A texel of
+		///   128 is on the edge, higher is inside and lower is outside, reaching 0 and 255 at spread pixels away.
+		///
+		std::vector<tbCore::uint8> ComputeDistanceField(const std::vector<tbCore::uint8>& coverage, const int width,
+			const int height, const float spread);
+
+		///
+		/// @details Averages each factor by factor block of texels into one, width and height must be multiples of the
+		///   factor. The glyphs are baked larger than the atlas so the edges in the field are smoother.
+		///
+		std::vector<tbCore::uint8> DownsampleField(const std::vector<tbCore::uint8>& field, const int width,
+			const int height, const int factor);
+
+		///
+		/// @details True when every character is in the atlas, a newline counts since it only moves the pen.
+		///
+		bool IsInSdfFontAtlas(const String& text);
+
+		bool LoadSdfFontCache(const String& filepath, SdfFontMetrics& metrics, std::vector<tbCore::uint8>& pixels);
+		void SaveSdfFontCache(const String& filepath, const SdfFontMetrics& metrics, const std::vector<tbCore::uint8>& pixels);
+	};
+
+	///
+	/// @details Loads the atlas from the cache, or bakes and caches it, on the first call and keeps the pixels so a lost
+	///   graphics context is quick to recover. The shaders must exist since baking draws the glyphs with TurtleBrains.
+	///
+	void CreateSdfFontTexture(void);
+	void DestroySdfFontTexture(void);
+
+	///
+	/// @details Binds the font atlas to kSdfFontTextureUnit and leaves texture unit 0 active for TurtleBrains.
+	///
+	void BindSdfFontTexture(void);
+
+	bool IsSdfFontBaked(void);
+	const SdfFontMetrics& GetSdfFontMetrics(void);
+
+};	//namespace Asteroids::Interface
+
+#endif /* Asteroids_SdfFont_hpp */
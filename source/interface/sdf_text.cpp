@@ -0,0 +1,157 @@
+///
+/// @file
+/// @details Interface text drawn from the signed distance field font atlas, so text of any size stays sharp from the
+///   one atlas and is only laid out again when the string or size changes. The atlas only holds printable ascii, a
+///   string with any other character, such as a localized one, is drawn with the TurtleBrains text as it was before.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../interface/sdf_text.hpp"
+#include "../interface/sdf_font.hpp"
+#include "../shader_system/shaders.hpp"
+
+#include <algorithm>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::SdfText::SdfText(void) :
+	tbGraphics::PolygonShape(),
+	mText(),
+	mTextSize(0.0f, 0.0f),
+	mPointSize(0.0f),
+	mFallbackText(""),
+	mIsUsingFallbackText(false)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::SdfText::SdfText(const String& text, const float pointSize) :
+	tbGraphics::PolygonShape(),
+	mText(),
+	mTextSize(0.0f, 0.0f),
+	mPointSize(0.0f),
+	mFallbackText(""),
+	mIsUsingFallbackText(false)
+{
+	SetText(text, pointSize);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::SdfText::~SdfText(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::SdfText::SetText(const String& text, const float pointSize)
+{
+	if (text == mText && pointSize == mPointSize)
+	{
+		return;
+	}
+
+	mText = text;
+	mPointSize = pointSize;
+	LayoutGlyphs();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::SdfText::LayoutGlyphs(void)
+{
+	ClearVertices();
+	SetAsTriangles();
+
+	mIsUsingFallbackText = (false == Implementation::IsInSdfFontAtlas(mText));
+	if (true == mIsUsingFallbackText)
+	{
+		mFallbackText.SetText(mText, mPointSize, "data/font/comic_mono.ttf");
+		mTextSize = Vector2(mFallbackText.GetWidth(), mFallbackText.GetHeight());
+		RecomputeBounds();
+		return;
+	}
+
+	mFallbackText.SetText("");
+
+	const SdfFontMetrics& metrics = GetSdfFontMetrics();
+	const float scale = mPointSize / static_cast<float>(metrics.mAtlasPointSize);
+	const Vector2 glyphStep(metrics.mAdvance * scale, metrics.mLineHeight * scale);
+	const Vector2 quadSize(metrics.mCellWidth * scale, metrics.mCellHeight * scale);
+	const Vector2 quadPadding(metrics.mPadding * scale, metrics.mPadding * scale);
+	const Vector2 cellUV(static_cast<float>(metrics.mCellWidth) / static_cast<float>(metrics.mAtlasWidth),
+		static_cast<float>(metrics.mCellHeight) / static_cast<float>(metrics.mAtlasHeight));
+
+	int column = 0;
+	int line = 0;
+	int widestLine = 0;
+	for (const char character : mText)
+	{
+		if ('\n' == character)
+		{
+			++line;
+			column = 0;
+			continue;
+		}
+
+		const char glyph = (character < kSdfFontFirstGlyph || character > kSdfFontLastGlyph) ? kSdfFontMissingGlyph : character;
+		if (' ' != glyph)
+		{
+			const int glyphIndex = glyph - kSdfFontFirstGlyph;
+			const Vector2 topLeftUV(static_cast<float>(glyphIndex % metrics.mColumns) * cellUV.x,
+				static_cast<float>(glyphIndex / metrics.mColumns) * cellUV.y);
+			const Vector2 topLeft(column * glyphStep.x - quadPadding.x, line * glyphStep.y - quadPadding.y);
+
+			const Vector2 topRight(topLeft.x + quadSize.x, topLeft.y);
+			const Vector2 bottomLeft(topLeft.x, topLeft.y + quadSize.y);
+			const Vector2 bottomRight(topLeft + quadSize);
+			const Vector2 topRightUV(topLeftUV.x + cellUV.x, topLeftUV.y);
+			const Vector2 bottomLeftUV(topLeftUV.x, topLeftUV.y + cellUV.y);
+			const Vector2 bottomRightUV(topLeftUV + cellUV);
+
+			AddVertex(topLeft, ColorPalette::White, topLeftUV);
+			AddVertex(topRight, ColorPalette::White, topRightUV);
+			AddVertex(bottomRight, ColorPalette::White, bottomRightUV);
+			AddVertex(topLeft, ColorPalette::White, topLeftUV);
+			AddVertex(bottomRight, ColorPalette::White, bottomRightUV);
+			AddVertex(bottomLeft, ColorPalette::White, bottomLeftUV);
+		}
+
+		++column;
+		widestLine = std::max(widestLine, column);
+	}
+
+	mTextSize = Vector2(widestLine * glyphStep.x, (true == mText.empty()) ? 0.0f : (line + 1) * glyphStep.y);
+	RecomputeBounds();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::SdfText::OnRender(void) const
+{
+	using namespace ShaderSystem;
+
+	if (true == mText.empty())
+	{
+		return;
+	}
+
+	if (true == mIsUsingFallbackText)
+	{
+		mFallbackText.SetColor(GetColor());
+		mFallbackText.Render();
+		return;
+	}
+
+	BindSdfFontTexture();
+	theShaderManager.PushAndBindShader(theSdfTextShader);
+	theShaderManager.ApplyUniformsForDraw();
+
+	PolygonShape::OnRender();
+
+	theShaderManager.PopShader();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
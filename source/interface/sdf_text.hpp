@@ -0,0 +1,61 @@
+///
+/// @file
+/// @details Interface text drawn from the signed distance field font atlas, so text of any size stays sharp from the
+///   one atlas and is only laid out again when the string or size changes. The atlas only holds printable ascii, a
+///   string with any other character, such as a localized one, is drawn with the TurtleBrains text as it was before.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_SdfText_hpp
+#define Asteroids_SdfText_hpp
+
+#include "../asteroids.hpp"
+
+#include <turtle_brains/graphics/tb_graphic.hpp>
+#include <turtle_brains/graphics/tb_basic_shapes.hpp>
+#include <turtle_brains/graphics/tb_text.hpp>
+
+namespace Asteroids::Interface
+{
+
+	class SdfText : public tbGraphics::PolygonShape
+	{
+	public:
+		SdfText(void);
+		SdfText(const String& text, const float pointSize);
+		virtual ~SdfText(void);
+
+		///
+		/// @details Lays out a quad for each glyph, but only when the text or point size differ from what is already
+		///   laid out. A newline starts the next line. Text with anything outside printable ascii is given to the
+		///   TurtleBrains text instead, which rasterizes comic_mono at the point size.
+		///
+		void SetText(const String& text, const float pointSize);
+
+		inline const String& GetText(void) const { return mText; }
+		inline float GetPointSize(void) const { return mPointSize; }
+		inline bool IsUsingFallbackText(void) const { return mIsUsingFallbackText; }
+
+		///
+		/// @details The size of the text itself, the quads reach past it by the padding of the distance field.
+		///
+		inline virtual tbGraphics::PixelSpace GetPixelWidth(void) const override { return static_cast<tbGraphics::PixelSpace>(mTextSize.x); }
+		inline virtual tbGraphics::PixelSpace GetPixelHeight(void) const override { return static_cast<tbGraphics::PixelSpace>(mTextSize.y); }
+
+	protected:
+		virtual void OnRender(void) const override;
+
+	private:
+		void LayoutGlyphs(void);
+
+		String mText;
+		Vector2 mTextSize;
+		float mPointSize;
+		mutable tbGraphics::Text mFallbackText; //mutable to take the color of this text when rendered.
+		bool mIsUsingFallbackText;
+	};
+
+};	//namespace Asteroids::Interface
+
+#endif /* Asteroids_SdfText_hpp */
@@ -0,0 +1,129 @@
+///
+/// @file
+/// @details Keeps recently laid out text around so interface text that shows the same string again, like a level
+///   number or a label flipping between two values, is not formatted and laid out from scratch.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../interface/text_cache.hpp"
+#include "../interface.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <string>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::MakeText(SdfText& textObject, const TextStyle style, const String& textString)
+{
+	switch (style)
+	{
+	case TextStyle::Title: MakeTitleText(textObject, textString); break;
+	case TextStyle::Normal: MakeNormalText(textObject, textString); break;
+	case TextStyle::Small: MakeSmallText(textObject, textString); break;
+	case TextStyle::Scalable: MakeScalableText(textObject, textString); break;
+	};
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::TextCache& Asteroids::Interface::TheTextCache(void)
+{
+	static TextCache theTextCache;
+	return theTextCache;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::Interface::TextCache::TextKeyHash::operator()(const TextKey& key) const
+{
+	return std::hash<std::string>()(key.mText) ^ (static_cast<size_t>(key.mStyle) * 0x9E3779B9u);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::TextCache::TextCache(void) :
+	mTexts(kCapacity),
+	mHits(0),
+	mMisses(0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::Interface::TextCache::~TextCache(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const Asteroids::Interface::SdfText& Asteroids::Interface::TextCache::GetText(const TextStyle style, const String& textString)
+{
+	bool wasCreated = false;
+	const SdfText& text = mTexts.FindOrCreate(TextKey{ style, textString }, [style, &textString](SdfText& newText) {
+		MakeText(newText, style, textString);
+	}, &wasCreated);
+
+	if (true == wasCreated) { ++mMisses; }
+	else { ++mHits; }
+
+	return text;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::Interface::TextCache::Clear(void)
+{
+	mTexts.Clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class LeastRecentlyUsedCacheTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		LeastRecentlyUsedCacheTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::LeastRecentlyUsedCacheTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			int creations = 0;
+			const auto createSquare = [&creations](const int key) {
+				return [&creations, key](int& value) { value = key * key; ++creations; };
+			};
+
+			Interface::Implementation::LeastRecentlyUsedCache<int, int> cache(2);
+			ExpectedValue(cache.FindOrCreate(2, createSquare(2)), 4, "Expected the value to be created.");
+			ExpectedValue(cache.FindOrCreate(3, createSquare(3)), 9, "Expected the second value to be created.");
+			ExpectedValue(cache.FindOrCreate(2, createSquare(2)), 4, "Expected the first value from the cache.");
+			ExpectedValue(creations, 2, "Expected a cached value not to be created again.");
+
+			//3 was used longest ago, so it makes room for 4.
+			cache.FindOrCreate(4, createSquare(4));
+			ExpectedValue(cache.Contains(3), false, "Expected the least recently used value evicted.");
+			ExpectedValue(cache.Contains(2), true, "Expected the recently used value kept.");
+			ExpectedValue(cache.GetSize(), size_t(2), "Expected the cache to stay at capacity.");
+			ExpectedValue(cache.GetEvictions(), size_t(1), "Expected one eviction.");
+
+			bool wasCreated = false;
+			cache.FindOrCreate(3, createSquare(3), &wasCreated);
+			ExpectedValue(wasCreated, true, "Expected an evicted value to be created again.");
+
+			return true;
+		}
+	};
+
+	LeastRecentlyUsedCacheTest theLeastRecentlyUsedCacheTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,142 @@
+///
+/// @file
+/// @details Keeps recently laid out text around so interface text that shows the same string again, like a level
+///   number or a label flipping between two values, is not formatted and laid out from scratch.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_TextCache_hpp
+#define Asteroids_TextCache_hpp
+
+#include "../asteroids.hpp"
+#include "../interface/sdf_text.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+
+#include <functional>
+#include <list>
+#include <tuple>
+#include <unordered_map>
+
+namespace Asteroids::Interface
+{
+
+	///
+	/// @details Each style is a font and size, matching MakeTitleText(), MakeNormalText() and friends.
+	///
+	enum class TextStyle { Title, Normal, Small, Scalable };
+
+	void MakeText(SdfText& textObject, const TextStyle style, const String& textString);
+
+	namespace Implementation
+	{
+		///
+		/// @details A fixed number of values, dropping the one used longest ago to make room. Values are created in
+		///   place and never copied or moved, so a reference stays good until that value is evicted.
+		///
+		template<typename KeyType, typename ValueType, typename HashType = std::hash<KeyType>> class LeastRecentlyUsedCache
+		{
+		public:
+			explicit LeastRecentlyUsedCache(const size_t capacity) :
+				mEntries(),
+				mLookup(),
+				mCapacity(capacity),
+				mEvictions(0)
+			{
+				tb_error_if(0 == capacity, "LeastRecentlyUsedCache needs room for at least one value.");
+			}
+
+			///
+			/// @details Returns the value for the key, calling createValue(ValueType&) on a default constructed value
+			///   when the key is not in the cache. Either way the value becomes the most recently used.
+			///
+			template<typename CreateFunction> ValueType& FindOrCreate(const KeyType& key, CreateFunction&& createValue,
+				bool* wasCreated = nullptr)
+			{
+				auto lookupIterator = mLookup.find(key);
+				if (mLookup.end() != lookupIterator)
+				{
+					mEntries.splice(mEntries.begin(), mEntries, lookupIterator->second);
+					if (nullptr != wasCreated) { *wasCreated = false; }
+					return lookupIterator->second->second;
+				}
+
+				if (mEntries.size() >= mCapacity)
+				{
+					mLookup.erase(mEntries.back().first);
+					mEntries.pop_back();
+					++mEvictions;
+				}
+
+				mEntries.emplace_front(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+				mLookup[key] = mEntries.begin();
+				createValue(mEntries.front().second);
+				if (nullptr != wasCreated) { *wasCreated = true; }
+				return mEntries.front().second;
+			}
+
+			inline bool Contains(const KeyType& key) const { return mLookup.end() != mLookup.find(key); }
+			inline size_t GetSize(void) const { return mEntries.size(); }
+			inline size_t GetEvictions(void) const { return mEvictions; }
+
+			void Clear(void)
+			{
+				mLookup.clear();
+				mEntries.clear();
+			}
+
+		private:
+			using Entry = std::pair<KeyType, ValueType>;
+
+			std::list<Entry> mEntries; //most recently used at the front.
+			std::unordered_map<KeyType, typename std::list<Entry>::iterator, HashType> mLookup;
+			const size_t mCapacity;
+			size_t mEvictions;
+		};
+	};
+
+	class TextCache : public tbCore::Noncopyable
+	{
+	public:
+		static const size_t kCapacity = 64;
+
+		TextCache(void);
+		~TextCache(void);
+
+		///
+		/// @details Returns the text laid out in the style, only laying it out if it was not already cached. The
+		///   reference is good until the next call, which may evict it; copy it to keep it longer.
+		///
+		const SdfText& GetText(const TextStyle style, const String& textString);
+
+		void Clear(void);
+
+		inline size_t GetHits(void) const { return mHits; }
+		inline size_t GetMisses(void) const { return mMisses; }
+		inline size_t GetEvictions(void) const { return mTexts.GetEvictions(); }
+
+	private:
+		struct TextKey
+		{
+			TextStyle mStyle;
+			String mText;
+
+			inline bool operator==(const TextKey& other) const { return mStyle == other.mStyle && mText == other.mText; }
+		};
+
+		struct TextKeyHash
+		{
+			size_t operator()(const TextKey& key) const;
+		};
+
+		Implementation::LeastRecentlyUsedCache<TextKey, SdfText, TextKeyHash> mTexts;
+		size_t mHits;
+		size_t mMisses;
+	};
+
+	TextCache& TheTextCache(void);
+
+};	//namespace Asteroids::Interface
+
+#endif /* Asteroids_TextCache_hpp */
@@ -7,6 +7,13 @@
 
 #include "../scenes/base_rusty_scene.hpp"
 #include "../shader_system/shader_manager.hpp"
+#include "../shader_system/gl_state_cache.hpp"
+#include "../graphics/dynamic_resolution.hpp"
+#include "../graphics/render_target_pool.hpp"
+#include "../graphics/frame_stages.hpp"
+#include "../graphics/snapshot_renderer.hpp"
+#include "../graphics/particle_system.hpp"
+#include "../graphics/sdf_shape.hpp"
 #include "../interface.hpp"
 
 #if defined(rusty_development)
@@ -34,17 +41,29 @@ namespace Asteroids
 Asteroids::BaseRustyScene::BaseRustyScene(void) :
 	tbGame::GameScene(),
 	mInterfaceEntities(),
+	mInterfaceLayout(),
 	mSettingsScreen(),
 	mSettingsButton(),
 	mWorldSpaceTarget(nullptr),
-	mInterfaceTarget(nullptr),
-	mLastScreenSize{ tbGraphics::ScreenWidth(), tbGraphics::ScreenHeight() }
+	mWorldSpaceTargetSize{ 0, 0 },
+	mFogOfWilderness(nullptr),
+	mLastScreenSize{ tbGraphics::ScreenWidth(), tbGraphics::ScreenHeight() },
+	mPendingScreenSize{ tbGraphics::ScreenWidth(), tbGraphics::ScreenHeight() },
+	mStableScreenFrames(0),
+	mRenderSnapshot(),
+	mSimulationClock(),
+	mLastDeltaTime(0.0f)
 {
 	// 2025-12-02: Watch out for scenes that call ClearInterfaceEntities(), since they would not have the settings button.
 	//   This is why the settings button does not display on the SupplyRunScene.
 	ButtonFactory::SetupButton(mSettingsButton, ButtonType::SettingsButton, "");
 	AddInterfaceEntity(mSettingsButton);
 
+	const Interface::LayoutNodeId settingsCorner = mInterfaceLayout.AddAnchored(Anchor::TopRight,
+		Vector2(-kPadding, kPadding), Anchor::TopRight);
+	mInterfaceLayout.AddGraphic(mSettingsButton, settingsCorner, true);
+	mSettingsButton.SetLayoutTree(&mInterfaceLayout);
+
 	mSettingsButton.SetClickCallback([this]() {
 		if (false == IsSettingsOpen())
 		{
@@ -59,6 +78,18 @@ Asteroids::BaseRustyScene::BaseRustyScene(void) :
 
 Asteroids::BaseRustyScene::~BaseRustyScene(void)
 {
+	ReleaseRenderTargets();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::BaseRustyScene::ReleaseRenderTargets(void)
+{
+	if (nullptr != mWorldSpaceTarget)
+	{
+		TheRenderTargetPool().Release(*mWorldSpaceTarget);
+		mWorldSpaceTarget = nullptr;
+	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -73,18 +104,46 @@ bool Asteroids::BaseRustyScene::IsSettingsOpen(void) const
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+Asteroids::FogOfWildernessEffect& Asteroids::BaseRustyScene::EnableFogOfWilderness(void)
+{
+	if (nullptr == mFogOfWilderness)
+	{
+		mFogOfWilderness = std::make_unique<FogOfWildernessEffect>();
+	}
+
+	return *mFogOfWilderness;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::BaseRustyScene::DisableFogOfWilderness(void)
+{
+	mFogOfWilderness.reset();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void Asteroids::BaseRustyScene::OnSimulate(void)
 {
+	TheFrameStages().EnterStage(FrameStage::Simulate);
+
 	tbGame::GameScene::OnSimulate();
 	mInterfaceEntities.Simulate();
+	mSimulationClock.AddSimulateStep();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 void Asteroids::BaseRustyScene::OnUpdate(const float deltaTime)
 {
-	mSettingsButton.SetOrigin(Anchor::TopRight);
-	mSettingsButton.SetPosition(Interface::GetAnchorPositionOfInterface(Anchor::TopRight, -kPadding, kPadding));
+	TheDynamicResolution().BeginFrame();
+	SdfShape::BeginFrame();
+	TheFrameStages().EnterStage(FrameStage::Update);
+
+	// 2026-10-19: The interface used to be positioned, and every button hit tested against the mouse, each update.
+	//   The hover is now found once for every button, against the layout as it was last drawn; the layout itself is
+	//   updated in the snapshot stage, see OnRender().
+	mInterfaceLayout.UpdateHover(Interface::ScreenSpaceToInterface(tbGame::Input::GetMousePosition()));
 
 	tbGame::GameScene::OnUpdate(deltaTime);
 	mInterfaceEntities.Update(deltaTime);
@@ -114,36 +173,107 @@ void Asteroids::BaseRustyScene::OnUpdate(const float deltaTime)
 	}
 #endif
 
-	if (nullptr == mWorldSpaceTarget || nullptr == mInterfaceTarget ||
-		mLastScreenSize.x != tbGraphics::ScreenWidth() || mLastScreenSize.y != tbGraphics::ScreenHeight())
+	if (nullptr != mFogOfWilderness)
+	{
+		mFogOfWilderness->Update(deltaTime);
+	}
+
+	if (false == GameManager::IsPaused())
+	{
+		TheParticleSystem().Update(deltaTime * GameManager::TimeMultiplier());
+	}
+
+	UpdateWorldTarget();
+	mSimulationClock.AddFrameTime(deltaTime);
+	mLastDeltaTime = deltaTime;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::BaseRustyScene::UpdateWorldTarget(void)
+{
+	// 2026-10-19: Dragging the window used to destroy and recreate the targets every frame of the drag. Now the new
+	//   size must hold for kResizeDebounceFrames before the world target is swapped, through the pool so sizes that
+	//   come back (or are used by another scene) are reused. The interface target was never rendered to, so is gone.
+	const IntVector2 screenSize{ tbGraphics::ScreenWidth(), tbGraphics::ScreenHeight() };
+	if (screenSize.x != mPendingScreenSize.x || screenSize.y != mPendingScreenSize.y)
+	{
+		mPendingScreenSize = screenSize;
+		mStableScreenFrames = 0;
+	}
+	else if (mStableScreenFrames < kResizeDebounceFrames)
+	{
+		++mStableScreenFrames;
+	}
+
+	const bool isScreenResized = (screenSize.x != mLastScreenSize.x || screenSize.y != mLastScreenSize.y);
+	if (nullptr == mWorldSpaceTarget || (true == isScreenResized && mStableScreenFrames >= kResizeDebounceFrames))
 	{
-		mLastScreenSize.x = tbGraphics::ScreenWidth();
-		mLastScreenSize.y = tbGraphics::ScreenHeight();
+		mLastScreenSize = screenSize;
+
+		if (nullptr != mWorldSpaceTarget)
+		{
+			TheRenderTargetPool().Release(*mWorldSpaceTarget);
+		}
+
+		const IntVector2 targetSize{ static_cast<int>(WorldTargetWidth()), static_cast<int>(WorldTargetHeight()) };
+		mWorldSpaceTarget = &TheRenderTargetPool().Acquire(targetSize.x, targetSize.y);
+		mWorldSpaceTargetSize = targetSize;
+	}
 
-		mWorldSpaceTarget = std::make_unique<tbGraphics::RenderTarget>(WorldTargetWidth(), WorldTargetHeight());
-		mInterfaceTarget = std::make_unique<tbGraphics::RenderTarget>(Interface::TargetWidth(), Interface::TargetHeight());
+	TheRenderTargetPool().BeginFrame();
+	TheDynamicResolution().SetTargetSize(mWorldSpaceTargetSize);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::BaseRustyScene::CaptureRenderSnapshot(RenderSnapshot& snapshot) const
+{
+	snapshot.mFrameNumber = TheFrameStages().GetFrameNumber();
+	snapshot.mDeltaTime = mLastDeltaTime;
+	snapshot.mWorldTargetSize = mWorldSpaceTargetSize;
+	snapshot.mRenderSize = TheDynamicResolution().GetRenderSize();
+
+	// 2026-10-19: World objects are drawn between their last two Simulate() steps so motion stays smooth when the
+	//   display refreshes faster than the simulation, or when fast-forward makes each step cover more ground.
+	snapshot.mInterpolation = mSimulationClock.GetInterpolation();
+	snapshot.mWorldSize = Vector2(WorldTargetWidth(), WorldTargetHeight());
+
+	snapshot.mHasFogOfWilderness = (nullptr != mFogOfWilderness);
+	if (true == snapshot.mHasFogOfWilderness)
+	{
+		mFogOfWilderness->CaptureSnapshot(snapshot.mFogOfWilderness);
 	}
 
-	// 2025-10-21: Technically starting the Render process here. It may fall into there "Update" time block!
+	RenderObjectWriter::WriteRenderObjects(*this, snapshot);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::BaseRustyScene::SubmitWorld(const RenderSnapshot& snapshot) const
+{
 	tb_error_if(nullptr == mWorldSpaceTarget, "Expected a valid world-space target to bind/update.");
-	tb_error_if(nullptr == mInterfaceTarget, "Expected a valid interface target to bind/update.");
 
+	//TurtleBrains changes textures, blending and the viewport behind the cache, start each frame knowing nothing.
+	ShaderSystem::TheGLStateCache().Invalidate();
+
+	TheDynamicResolution().BeginGPUWork();
+
+	mWorldSpaceTarget->BindRenderTarget();
+	mWorldSpaceTarget->ClearRenderTarget(ColorPalette::Black);
+	tbGraphics::Implementation::Renderer::BeginDraw();
+	TheDynamicResolution().ApplyViewport();
+	OnRenderGameWorld();
+
+	if (true == snapshot.mHasFogOfWilderness && nullptr != mFogOfWilderness)
 	{
-		mWorldSpaceTarget->BindRenderTarget();
-		mWorldSpaceTarget->ClearRenderTarget(ColorPalette::Black);
-		tbGraphics::Implementation::Renderer::BeginDraw();
-		OnRenderGameWorld();
-	//	mWorldSpaceTarget->UnbindRenderTarget();
-	//}
-
-	//{
-
-	//	mInterfaceTarget->BindRenderTarget();
-	//	mInterfaceTarget->ClearRenderTarget(ColorPalette::Transparent);
-	//	tbImplementation::Renderer::BeginDraw();
-		OnRenderInterface();
-		mInterfaceTarget->UnbindRenderTarget();
+		mFogOfWilderness->Render(snapshot.mFogOfWilderness, *mWorldSpaceTarget);
 	}
+
+	OnRenderInterface();
+	mWorldSpaceTarget->UnbindRenderTarget();
+
+	TheDynamicResolution().EndGPUWork();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -151,6 +281,10 @@ void Asteroids::BaseRustyScene::OnUpdate(const float deltaTime)
 void Asteroids::BaseRustyScene::OnRenderGameWorld(void) const
 {
 	tbGame::GameScene::OnRender();
+
+	//Everything in the traversal so far is the backdrop, the objects from the snapshot go on top of it.
+	TheSnapshotRenderer().Render(mRenderSnapshot);
+	TheParticleSystem().Render();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -164,25 +298,39 @@ void Asteroids::BaseRustyScene::OnRenderInterface(void) const
 
 void Asteroids::BaseRustyScene::OnRender(void) const
 {
-	ShaderSystem::theShaderManager.BindShader(ShaderSystem::InvalidShader());
+	// 2026-10-19: The world used to be rendered at the end of OnUpdate(), fusing gameplay and GL submission, and
+	//   anything a derived scene changed after calling BaseRustyScene::OnUpdate() showed up a frame late. Now update
+	//   only changes the game, the snapshot stage gathers what the render needs and the render stage submits it here.
+	TheFrameStages().EnterStage(FrameStage::Snapshot);
 
-	tb_error_if(nullptr == mWorldSpaceTarget, "Expected a valid world-space target to render.");
-	tb_error_if(nullptr == mInterfaceTarget, "Expected a valid interface target to render.");
+	//After every update, including the parts of a derived scene that run after BaseRustyScene::OnUpdate(), so a HUD
+	//  label that changed size is drawn at its new place this frame. Only moves anything after a resize or size change.
+	mInterfaceLayout.Update();
 
-	tbGraphics::Sprite gameWorldSprite(mWorldSpaceTarget->GetColorTextureHandle());
+	mRenderSnapshot.ClearRenderObjects();
+	CaptureRenderSnapshot(mRenderSnapshot);
+	const RenderSnapshot& snapshot = mRenderSnapshot;
+
+	TheFrameStages().EnterStage(FrameStage::Render);
+	SubmitWorld(snapshot);
+
+	//The world target needed BeginDraw() to set up its view, the window needs it again to get its own view back.
+	tbGraphics::Implementation::Renderer::BeginDraw();
+	ShaderSystem::TheGLStateCache().Invalidate();
+	ShaderSystem::theShaderManager.BindShader(ShaderSystem::InvalidShader());
+
+	// 2026-10-19: With dynamic resolution only the bottom-left corner of the world target was rendered into, which
+	//   is the top-left of the texture in TurtleBrains pixel space, stretch just that portion over the window.
+	const IntVector2 renderSize = snapshot.mRenderSize;
+	tbGraphics::Sprite gameWorldSprite(tbGraphics::SpriteFrame::CreateWith(mWorldSpaceTarget->GetColorTextureHandle(),
+		0, 0, static_cast<tbGraphics::PixelSpace>(renderSize.x), static_cast<tbGraphics::PixelSpace>(renderSize.y)));
 	gameWorldSprite.SetOrigin(Anchor::Center);
 	gameWorldSprite.SetPosition(tbGraphics::ScreenCenter());
 	gameWorldSprite.SetFlippedVertically(true);
-	gameWorldSprite.SetScale(GameScale());
+	gameWorldSprite.SetScale(GameScale() * static_cast<float>(snapshot.mWorldTargetSize.x) / static_cast<float>(renderSize.x),
+		GameScale() * static_cast<float>(snapshot.mWorldTargetSize.y) / static_cast<float>(renderSize.y));
 	gameWorldSprite.Render();
 
-	//tbGraphics::Sprite interfaceSprite(mInterfaceTarget->GetColorTextureHandle());
-	//interfaceSprite.SetOrigin(Anchor::Center);
-	//interfaceSprite.SetPosition(tbGraphics::ScreenCenter());
-	//interfaceSprite.SetFlippedVertically(true);
-	//interfaceSprite.SetScale(Interface::Scale());
-	//interfaceSprite.Render();
-
 #if defined(rusty_development)
 	Development::RenderSafeZone();
 
@@ -191,6 +339,9 @@ void Asteroids::BaseRustyScene::OnRender(void) const
 	//fps.SetPosition(tbGraphics::ScreenWidth() - kPadding, tbGraphics::ScreenHeight() - kPadding);
 	//fps.Render();
 #endif
+
+	TheDynamicResolution().EndFrame();
+	TheFrameStages().EndFrame();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -205,6 +356,12 @@ void Asteroids::BaseRustyScene::OnOpen(void)
 void Asteroids::BaseRustyScene::OnClose(void)
 {
 	tbGame::GameScene::OnClose();
+
+	//Hand the target back so the next scene, most likely the same size, can pick it up rather than create another.
+	ReleaseRenderTargets();
+
+	//The particles are shared by every scene, leftover debris should not carry into the next one.
+	TheParticleSystem().Clear();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
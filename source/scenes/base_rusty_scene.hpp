@@ -11,6 +11,10 @@
 #include "../asteroids.hpp"
 #include "../entities/button_entity.hpp"
 #include "../entities/settings_screen_entity.hpp"
+#include "../graphics/fog_of_wilderness_effect.hpp"
+#include "../graphics/render_interpolation.hpp"
+#include "../graphics/render_snapshot.hpp"
+#include "../interface/layout_tree.hpp"
 
 #include <turtle_brains/game/tb_game_scene.hpp>
 #include <turtle_brains/graphics/tb_render_target.hpp>
@@ -37,6 +41,13 @@ namespace Asteroids
 		inline void RemoveInterfaceEntity(tbGame::Entity* entity) { mInterfaceEntities.RemoveEntity(entity); }
 		inline void RemoveInterfaceEntities(const tbGame::EntityType& byType = tbGame::Entity::kInvalidType) { mInterfaceEntities.RemoveEntities(byType); }
 
+		///
+		/// @details The fog of wilderness is off unless a scene asks for it, once enabled it is rendered over the game
+		///   world at Settings::FogResolutionScale() and composited back in before the interface.
+		///
+		FogOfWildernessEffect& EnableFogOfWilderness(void);
+		void DisableFogOfWilderness(void);
+
 	protected:
 		virtual void OnOpen(void) override;
 		virtual void OnClose(void) override;
@@ -47,18 +58,44 @@ namespace Asteroids
 		virtual void OnRenderGameWorld(void) const;
 		virtual void OnRenderInterface(void) const;
 
+		///
+		/// @details Interface elements added here are placed when the window resizes or they change size, rather than
+		///   every update, and buttons added as hit testable share one hover test for the whole interface.
+		///
+		inline Interface::LayoutTree& GetInterfaceLayout(void) { return mInterfaceLayout; }
+
 	private:
 		virtual void OnRender(void) const override;
 		virtual void OnRuntimeReload(void);
+		void ReleaseRenderTargets(void);
+
+		///
+		/// @details The stages of a frame, in order: UpdateWorldTarget() at the end of the update stage keeps the target
+		///   sized for the window, CaptureRenderSnapshot() gathers the state the render stage needs, including every
+		///   RenderObjectWriter in the scene, and SubmitWorld() renders the world and interface into the world target.
+		///
+		void UpdateWorldTarget(void);
+		void CaptureRenderSnapshot(RenderSnapshot& snapshot) const;
+		void SubmitWorld(const RenderSnapshot& snapshot) const;
 
 	private:
 		tbGame::EntityManager mInterfaceEntities;
+		mutable Interface::LayoutTree mInterfaceLayout; //Laid out in the snapshot stage of OnRender().
 		SettingsScreenEntity mSettingsScreen;
 		ButtonEntity mSettingsButton;
 
-		std::unique_ptr<tbGraphics::RenderTarget> mWorldSpaceTarget;
-		std::unique_ptr<tbGraphics::RenderTarget> mInterfaceTarget;
+		static const int kResizeDebounceFrames = 10;
+
+		tbGraphics::RenderTarget* mWorldSpaceTarget; //Owned by TheRenderTargetPool()
+		IntVector2 mWorldSpaceTargetSize;
+		std::unique_ptr<FogOfWildernessEffect> mFogOfWilderness;
 		IntVector2 mLastScreenSize;
+		IntVector2 mPendingScreenSize;
+		int mStableScreenFrames;
+
+		mutable RenderSnapshot mRenderSnapshot;
+		SimulationClock mSimulationClock;
+		float mLastDeltaTime;
 	};
 
 };	//namespace Asteroids
@@ -17,13 +17,28 @@
 
 Asteroids::GameplayScene::GameplayScene(void) :
 	BaseRustyScene(),
-	mSpaceBackdrop(),
-	mRocketShip(ScreenSpaceToWorldSpace(tbGraphics::ScreenCenter()))
+	mSpaceBackdrop("data/space/space_blue_nebula_08.png"),
+	mRocketShip(ScreenSpaceToWorldSpace(tbGraphics::ScreenCenter())),
+	mLevelLabel(Interface::TextStyle::Title, [](const int level, const int) {
+		return NotLocalized("Level ") + tb_string(level);
+	}),
+	mExperienceLabel(Interface::TextStyle::Normal, [](const int experience, const int experienceForNextLevel) {
+		return tb_string(experience) + NotLocalized(" / ") + tb_string(experienceForNextLevel) + NotLocalized(" xp");
+	})
 {
+	// 2026-10-19: The ParallaxBackdrop drew each layer as its own full screen sprite. The SpaceBackdrop samples all
+	//   the layers in one full screen draw, so the distant star layers cost no extra draws or fill.
 	mSpaceBackdrop.ResetTargetArea(WorldTargetWidth(), WorldTargetHeight());
-	tbGraphics::Sprite spaceSprite("data/space/space_blue_nebula_08.png");
-	spaceSprite.SetColor(Color(0x99FFFFFF));
-	mSpaceBackdrop.AddParallaxLayer(spaceSprite, 1.0f);
+	mSpaceBackdrop.AddParallaxLayer(BackdropTexture::StarField, 0.25f, 0.6f);
+	mSpaceBackdrop.AddParallaxLayer(BackdropTexture::StarField, 0.5f, 0.9f, 1.0f, 2.0f);
+	mSpaceBackdrop.AddParallaxLayer(BackdropTexture::Nebula, 1.0f, 0.6f);
+
+	Interface::LayoutTree& layout = GetInterfaceLayout();
+	const Interface::LayoutNodeId hudCorner = layout.AddAnchored(Anchor::TopLeft, Vector2(kPadding, kPadding), Anchor::TopLeft);
+	const Interface::LayoutNodeId hudLabels = layout.AddStack(Interface::StackDirection::Horizontal, kPadding * 2.0f,
+		Interface::StackAlignment::End, hudCorner);
+	layout.AddGraphic(mLevelLabel, hudLabels);
+	layout.AddGraphic(mExperienceLabel, hudLabels);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -49,7 +64,7 @@ void Asteroids::GameplayScene::OnUpdate(const float deltaTime)
 	}
 
 	Vector2 movement(100.0f, 100.0f);
-	mSpaceBackdrop.SetPosition(mSpaceBackdrop.GetPosition() + movement * deltaTime);
+	mSpaceBackdrop.SetScrollPosition(mSpaceBackdrop.GetScrollPosition() + movement * deltaTime);
 
 	BaseRustyScene::OnUpdate(deltaTime);
 
@@ -67,6 +82,12 @@ void Asteroids::GameplayScene::OnUpdate(const float deltaTime)
 		const int asteroidSize = 12;
 		AddEntity(new AsteroidEntity(asteroidSize, mouseInWorldSpace));
 	}
+
+	// 2026-10-19: These were new Text objects formatted and laid out in every OnRenderInterface(), now the labels are
+	//   kept and only laid out again when the level or experience actually changes.
+	mLevelLabel.SetValues(static_cast<int>(GetStat(Stat::Level)));
+	mExperienceLabel.SetValues(static_cast<int>(GetStat(Stat::Experience)),
+		static_cast<int>(GameManager::GetExperienceForNextLevel()));
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -91,18 +112,8 @@ void Asteroids::GameplayScene::OnRenderInterface(void) const
 {
 	BaseRustyScene::OnRenderInterface();
 
-	tbGraphics::Text levelText;
-	Interface::MakeTitleText(levelText, MyFormatter() << NotLocalized("Level ") << GetStatAsIntegerString(Stat::Level));
-	levelText.SetOrigin(Anchor::TopLeft);
-	levelText.SetPosition(Interface::GetAnchorPositionOfInterface(Anchor::TopLeft, kPadding, kPadding));
-	levelText.Render();
-
-	tbGraphics::Text experienceText;
-	Interface::MakeNormalText(experienceText, GetStatAsIntegerString(Stat::Experience) +
-		NotLocalized(" / ") + MakeIntegerString(GameManager::GetExperienceForNextLevel()) + NotLocalized(" xp"));
-	experienceText.SetOrigin(Anchor::BottomLeft);
-	experienceText.SetPosition(levelText.GetAnchorPosition(Anchor::BottomRight, kPadding * 2.0f, 0.0f));
-	experienceText.Render();
+	mLevelLabel.Render();
+	mExperienceLabel.Render();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -10,9 +10,10 @@
 
 #include "../scenes/base_rusty_scene.hpp"
 #include "../entities/rocket_ship_entity.hpp"
+#include "../graphics/space_backdrop.hpp"
+#include "../interface/hud_label.hpp"
 
 #include <turtle_brains/game/tb_game_scene.hpp>
-#include <turtle_brains/express/graphics/tbx_parallax_backdrop.hpp>
 
 namespace Asteroids
 {
@@ -32,8 +33,10 @@ namespace Asteroids
 		virtual void OnClose(void) override;
 
 	private:
-		tbxGraphics::ParallaxBackdrop mSpaceBackdrop;
+		SpaceBackdrop mSpaceBackdrop;
 		RocketShipEntity mRocketShip;
+		Interface::HudLabel mLevelLabel;
+		Interface::HudLabel mExperienceLabel;
 	};
 
 };	//namespace Asteroids
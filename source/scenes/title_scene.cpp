@@ -53,6 +53,17 @@ Asteroids::TitleScene::TitleScene(void) :
 	mQuitButton.SetClickCallback([]() {
 		SceneManager::QuitGame();
 	});
+
+	Interface::LayoutTree& layout = GetInterfaceLayout();
+	layout.AddGraphic(mTitleText, layout.AddAnchored(Anchor::Center, Vector2::Zero(), Anchor::Center));
+
+	const float quarterInterfaceHeight = Interface::Height() / 3.0f;
+	layout.AddGraphic(mPlayButton, layout.AddAnchored(Anchor::BottomCenter,
+		Vector2(0.0f, -quarterInterfaceHeight), Anchor::Center), true);
+	mPlayButton.SetLayoutTree(&layout);
+
+	layout.AddGraphic(mQuitButton, layout.AddAnchored(Anchor::BottomCenter, Vector2(0.0f, -kPadding), Anchor::BottomCenter), true);
+	mQuitButton.SetLayoutTree(&layout);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -86,13 +97,6 @@ void Asteroids::TitleScene::OnUpdate(const float deltaTime)
 	//	++profileIndex;
 	//}
 
-	const float quarterInterfaceHeight = Interface::Height() / 3.0f;
-	mPlayButton.SetOrigin(Anchor::Center);
-	mPlayButton.SetPosition(Interface::GetAnchorPositionOfInterface(Anchor::BottomCenter, 0.0f, -quarterInterfaceHeight));
-
-	mQuitButton.SetOrigin(Anchor::BottomCenter);
-	mQuitButton.SetPosition(Interface::GetAnchorPositionOfInterface(Anchor::BottomCenter, 0.0f, - kPadding));
-
 	if (false == IsSettingsOpen())
 	{
 		if (true == tbGame::Input::IsKeyPressed(tbApplication::tbKeyEscape))
@@ -100,9 +104,6 @@ void Asteroids::TitleScene::OnUpdate(const float deltaTime)
 			SceneManager::QuitGame();
 		}
 
-		mTitleText.SetOrigin(Anchor::Center);
-		mTitleText.SetPosition(Interface::GetAnchorPositionOfInterface(Anchor::Center));
-
 		mQuitButton.SetActive(true);
 		mPlayButton.SetActive(true);
 		//for (ButtonEntity& profileButton : mProfileButtons)
@@ -0,0 +1,313 @@
+///
+/// @file
+/// @details A thin shadow of the OpenGL state that Asteroids changes itself so redundant state changes can be dropped
+///   before they reach the driver.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../shader_system/gl_state_cache.hpp"
+#include "../asteroids.hpp"
+
+// 2025-11-19: The ShaderSystem Implementation depends on the TurtleBrains renderer, for check_gl_errors and other
+//   implementation details. We 'know what we are doing'.
+#define TurtleBrains_LetMeHave_Implementation
+#include <turtle_brains/graphics/implementation/tbi_renderer.hpp>
+#undef TurtleBrains_LetMeHave_Implementation
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <vector>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ShaderSystem::GLFunctionTable Asteroids::ShaderSystem::OpenGLFunctionTable(void)
+{
+	//The GL entry points are often macros around function pointers loaded at runtime, wrap them to be safe.
+	GLFunctionTable functionTable;
+	functionTable.mUseProgram = [](GLuint program) { tb_check_gl_errors(glUseProgram(program)); };
+	functionTable.mActiveTexture = [](GLenum textureUnit) { tb_check_gl_errors(glActiveTexture(textureUnit)); };
+	functionTable.mBindTexture = [](GLenum target, GLuint texture) { tb_check_gl_errors(glBindTexture(target, texture)); };
+	functionTable.mBindVertexArray = [](GLuint vertexArray) { tb_check_gl_errors(glBindVertexArray(vertexArray)); };
+	functionTable.mEnable = [](GLenum capability) { tb_check_gl_errors(glEnable(capability)); };
+	functionTable.mDisable = [](GLenum capability) { tb_check_gl_errors(glDisable(capability)); };
+	functionTable.mBlendFunc = [](GLenum source, GLenum destination) { tb_check_gl_errors(glBlendFunc(source, destination)); };
+	functionTable.mViewport = [](GLint x, GLint y, GLsizei width, GLsizei height) { tb_check_gl_errors(glViewport(x, y, width, height)); };
+	return functionTable;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ShaderSystem::GLStateCache& Asteroids::ShaderSystem::TheGLStateCache(void)
+{
+	static GLStateCache theGLStateCache(OpenGLFunctionTable());
+	return theGLStateCache;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ShaderSystem::GLStateCache::GLStateCache(const GLFunctionTable& functionTable) :
+	tbCore::Noncopyable(),
+	mFunctions(functionTable),
+	mProgram(),
+	mActiveTextureUnit(),
+	mTextures(),
+	mVertexArray(),
+	mIsBlendEnabled(),
+	mBlendFunction(),
+	mViewport(),
+	mForwardedCalls(0),
+	mDroppedCalls(0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ShaderSystem::GLStateCache::~GLStateCache(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::UseProgram(const GLuint program)
+{
+	if (true == mProgram.Matches(program))
+	{
+		++mDroppedCalls;
+		return;
+	}
+
+	mFunctions.mUseProgram(program);
+	mProgram.Set(program);
+	++mForwardedCalls;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::BindTexture(const size_t textureUnit, const GLenum target, const GLuint texture)
+{
+	tb_error_if(textureUnit >= kMaximumTextureUnits, "GLStateCache only tracks %d texture units.", static_cast<int>(kMaximumTextureUnits));
+
+	const TextureBinding binding{ target, texture };
+	if (true == mTextures[textureUnit].Matches(binding))
+	{
+		++mDroppedCalls;
+		return;
+	}
+
+	SetActiveTextureUnit(textureUnit);
+	mFunctions.mBindTexture(target, texture);
+	mTextures[textureUnit].Set(binding);
+	++mForwardedCalls;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::SetActiveTextureUnit(const size_t textureUnit)
+{
+	tb_error_if(textureUnit >= kMaximumTextureUnits, "GLStateCache only tracks %d texture units.", static_cast<int>(kMaximumTextureUnits));
+
+	if (true == mActiveTextureUnit.Matches(textureUnit))
+	{
+		return;
+	}
+
+	mFunctions.mActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + textureUnit));
+	mActiveTextureUnit.Set(textureUnit);
+	++mForwardedCalls;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::BindVertexArray(const GLuint vertexArray)
+{
+	if (true == mVertexArray.Matches(vertexArray))
+	{
+		++mDroppedCalls;
+		return;
+	}
+
+	mFunctions.mBindVertexArray(vertexArray);
+	mVertexArray.Set(vertexArray);
+	++mForwardedCalls;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::SetBlendEnabled(const bool isEnabled)
+{
+	if (true == mIsBlendEnabled.Matches(isEnabled))
+	{
+		++mDroppedCalls;
+		return;
+	}
+
+	if (true == isEnabled)
+	{
+		mFunctions.mEnable(GL_BLEND);
+	}
+	else
+	{
+		mFunctions.mDisable(GL_BLEND);
+	}
+
+	mIsBlendEnabled.Set(isEnabled);
+	++mForwardedCalls;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::SetBlendFunction(const GLenum sourceFactor, const GLenum destinationFactor)
+{
+	const BlendFunction blendFunction{ sourceFactor, destinationFactor };
+	if (true == mBlendFunction.Matches(blendFunction))
+	{
+		++mDroppedCalls;
+		return;
+	}
+
+	mFunctions.mBlendFunc(sourceFactor, destinationFactor);
+	mBlendFunction.Set(blendFunction);
+	++mForwardedCalls;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::SetViewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height)
+{
+	const Viewport viewport{ x, y, width, height };
+	if (true == mViewport.Matches(viewport))
+	{
+		++mDroppedCalls;
+		return;
+	}
+
+	mFunctions.mViewport(x, y, width, height);
+	mViewport.Set(viewport);
+	++mForwardedCalls;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::Invalidate(void)
+{
+	mProgram = Shadow<GLuint>();
+	mActiveTextureUnit = Shadow<size_t>();
+	mTextures.fill(Shadow<TextureBinding>());
+	mVertexArray = Shadow<GLuint>();
+	mIsBlendEnabled = Shadow<bool>();
+	mBlendFunction = Shadow<BlendFunction>();
+	mViewport = Shadow<Viewport>();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::InvalidateProgram(void)
+{
+	mProgram = Shadow<GLuint>();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::GLStateCache::ResetCounters(void)
+{
+	mForwardedCalls = 0;
+	mDroppedCalls = 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class GLStateCacheTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		GLStateCacheTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::GLStateCacheTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using ShaderSystem::GLStateCache;
+
+			theMockCalls.clear();
+			GLStateCache stateCache(MockFunctionTable());
+
+			stateCache.UseProgram(3);
+			stateCache.UseProgram(3);
+			stateCache.UseProgram(4);
+			ExpectedValue<size_t>(theMockCalls.size(), 2, "Expected the repeated glUseProgram() to be dropped.");
+			ExpectedValue<size_t>(stateCache.GetDroppedCalls(), 1, "Expected one dropped call after UseProgram().");
+
+			theMockCalls.clear();
+			stateCache.BindTexture(0, GL_TEXTURE_2D, 7);
+			stateCache.BindTexture(0, GL_TEXTURE_2D, 7);
+			stateCache.BindTexture(1, GL_TEXTURE_2D, 7);
+			stateCache.BindTexture(1, GL_TEXTURE_2D, 8);
+			stateCache.BindTexture(0, GL_TEXTURE_2D, 7);
+			//ActiveTexture(0), Bind(7), ActiveTexture(1), Bind(7), Bind(8); the last Bind on unit 0 is known.
+			ExpectedValue<size_t>(theMockCalls.size(), 5, "Expected texture binds to be tracked per texture unit.");
+			ExpectedValue<String>(theMockCalls.back(), "BindTexture 8", "Expected unit 1 to be active without a new ActiveTexture().");
+
+			theMockCalls.clear();
+			stateCache.BindVertexArray(2);
+			stateCache.BindVertexArray(2);
+			stateCache.SetBlendEnabled(true);
+			stateCache.SetBlendEnabled(true);
+			stateCache.SetBlendEnabled(false);
+			stateCache.SetBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			stateCache.SetBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			stateCache.SetViewport(0, 0, 1920, 1080);
+			stateCache.SetViewport(0, 0, 1920, 1080);
+			stateCache.SetViewport(0, 0, 960, 540);
+			ExpectedValue<size_t>(theMockCalls.size(), 6, "Expected redundant vertex array, blend and viewport calls to be dropped.");
+
+			theMockCalls.clear();
+			stateCache.ResetCounters();
+			stateCache.Invalidate();
+			stateCache.UseProgram(4);
+			stateCache.BindVertexArray(2);
+			ExpectedValue<size_t>(theMockCalls.size(), 2, "Expected calls to be forwarded after Invalidate().");
+			ExpectedValue<size_t>(stateCache.GetForwardedCalls(), 2, "Expected two forwarded calls after ResetCounters().");
+			ExpectedValue<size_t>(stateCache.GetDroppedCalls(), 0, "Expected no dropped calls after ResetCounters().");
+
+			theMockCalls.clear();
+			stateCache.InvalidateProgram();
+			stateCache.UseProgram(4);
+			stateCache.BindVertexArray(2);
+			ExpectedValue<size_t>(theMockCalls.size(), 1, "Expected only the program to be forgotten by InvalidateProgram().");
+
+			return true;
+		}
+
+	private:
+		static ShaderSystem::GLFunctionTable MockFunctionTable(void)
+		{
+			ShaderSystem::GLFunctionTable functionTable;
+			functionTable.mUseProgram = [](GLuint program) { theMockCalls.push_back("UseProgram " + tb_string(program)); };
+			functionTable.mActiveTexture = [](GLenum unit) { theMockCalls.push_back("ActiveTexture " + tb_string(unit - GL_TEXTURE0)); };
+			functionTable.mBindTexture = [](GLenum, GLuint texture) { theMockCalls.push_back("BindTexture " + tb_string(texture)); };
+			functionTable.mBindVertexArray = [](GLuint vertexArray) { theMockCalls.push_back("BindVertexArray " + tb_string(vertexArray)); };
+			functionTable.mEnable = [](GLenum) { theMockCalls.push_back("Enable"); };
+			functionTable.mDisable = [](GLenum) { theMockCalls.push_back("Disable"); };
+			functionTable.mBlendFunc = [](GLenum, GLenum) { theMockCalls.push_back("BlendFunc"); };
+			functionTable.mViewport = [](GLint, GLint, GLsizei, GLsizei) { theMockCalls.push_back("Viewport"); };
+			return functionTable;
+		}
+
+		static std::vector<String> theMockCalls;
+	};
+
+	std::vector<String> GLStateCacheTest::theMockCalls;
+	GLStateCacheTest theGLStateCacheTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,133 @@
+///
+/// @file
+/// @details A thin shadow of the OpenGL state that Asteroids changes itself so redundant state changes can be dropped
+///   before they reach the driver.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_GLStateCache_hpp
+#define Asteroids_GLStateCache_hpp
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+#include <turtle_brains/core/tb_opengl.hpp>
+
+#include <array>
+
+namespace Asteroids::ShaderSystem
+{
+
+	///
+	/// @details The OpenGL calls that the GLStateCache will forward to, which allows the unit tests to provide a mock
+	///   table and run on a machine without a GPU or context.
+	///
+	struct GLFunctionTable
+	{
+		void (*mUseProgram)(GLuint program);
+		void (*mActiveTexture)(GLenum textureUnit);
+		void (*mBindTexture)(GLenum target, GLuint texture);
+		void (*mBindVertexArray)(GLuint vertexArray);
+		void (*mEnable)(GLenum capability);
+		void (*mDisable)(GLenum capability);
+		void (*mBlendFunc)(GLenum sourceFactor, GLenum destinationFactor);
+		void (*mViewport)(GLint x, GLint y, GLsizei width, GLsizei height);
+	};
+
+	GLFunctionTable OpenGLFunctionTable(void);
+
+	///
+	/// @details Tracks the current program, the textures bound to each unit, the vertex array, blending and viewport
+	///   and only forwards the calls that would change something.
+	///
+	///   TurtleBrains issues its own GL calls without going through the cache, so the shadow can only be trusted for
+	///   state TurtleBrains leaves alone (the program) or right after Invalidate(). Invalidate() is called at the start
+	///   of each frame and should be called after handing control to code that could change the state behind it.
+	///
+	class GLStateCache : public tbCore::Noncopyable
+	{
+	public:
+		static const size_t kMaximumTextureUnits = 16;
+
+		explicit GLStateCache(const GLFunctionTable& functionTable);
+		~GLStateCache(void);
+
+		void UseProgram(const GLuint program);
+		void BindTexture(const size_t textureUnit, const GLenum target, const GLuint texture);
+
+		///
+		/// @details TurtleBrains expects texture unit 0 to be active, call this with 0 after binding to any other unit.
+		///
+		void SetActiveTextureUnit(const size_t textureUnit);
+
+		void BindVertexArray(const GLuint vertexArray);
+		void SetBlendEnabled(const bool isEnabled);
+		void SetBlendFunction(const GLenum sourceFactor, const GLenum destinationFactor);
+		void SetViewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height);
+
+		///
+		/// @details Forgets everything that is known about the state, so the next call of each kind is forwarded.
+		///
+		void Invalidate(void);
+
+		///
+		/// @details Forgets only the program, for when a program was deleted and its name may be reused by the next
+		///   program created, see DestroyShaderFromOpenGL().
+		///
+		void InvalidateProgram(void);
+
+		inline size_t GetForwardedCalls(void) const { return mForwardedCalls; }
+		inline size_t GetDroppedCalls(void) const { return mDroppedCalls; }
+		void ResetCounters(void);
+
+	private:
+		template<typename Type> struct Shadow
+		{
+			Type mValue{};
+			bool mIsKnown = false;
+
+			inline bool Matches(const Type& value) const { return true == mIsKnown && value == mValue; }
+			inline void Set(const Type& value) { mValue = value; mIsKnown = true; }
+		};
+
+		struct TextureBinding
+		{
+			GLenum mTarget;
+			GLuint mTexture;
+			inline bool operator==(const TextureBinding& other) const { return mTarget == other.mTarget && mTexture == other.mTexture; }
+		};
+
+		struct BlendFunction
+		{
+			GLenum mSource;
+			GLenum mDestination;
+			inline bool operator==(const BlendFunction& other) const { return mSource == other.mSource && mDestination == other.mDestination; }
+		};
+
+		struct Viewport
+		{
+			GLint mX;
+			GLint mY;
+			GLsizei mWidth;
+			GLsizei mHeight;
+			inline bool operator==(const Viewport& other) const {
+				return mX == other.mX && mY == other.mY && mWidth == other.mWidth && mHeight == other.mHeight; }
+		};
+
+		GLFunctionTable mFunctions;
+		Shadow<GLuint> mProgram;
+		Shadow<size_t> mActiveTextureUnit;
+		std::array<Shadow<TextureBinding>, kMaximumTextureUnits> mTextures;
+		Shadow<GLuint> mVertexArray;
+		Shadow<bool> mIsBlendEnabled;
+		Shadow<BlendFunction> mBlendFunction;
+		Shadow<Viewport> mViewport;
+
+		size_t mForwardedCalls;
+		size_t mDroppedCalls;
+	};
+
+	GLStateCache& TheGLStateCache(void);
+
+};	//namespace Asteroids::ShaderSystem
+
+#endif /* Asteroids_GLStateCache_hpp */
@@ -0,0 +1,262 @@
+///
+/// @file
+/// @details Bakes the seamless value noise used by the fog of wilderness effect into a tiling texture so the shader
+///   can sample it rather than evaluating the noise for every fragment.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../shader_system/noise_texture.hpp"
+#include "../shader_system/gl_state_cache.hpp"
+#include "../user_settings.hpp"
+
+// 2025-11-19: The ShaderSystem Implementation depends on the TurtleBrains renderer, for check_gl_errors and other
+//   implementation details. We 'know what we are doing'.
+#define TurtleBrains_LetMeHave_Implementation
+#include <turtle_brains/graphics/implementation/tbi_renderer.hpp>
+#undef TurtleBrains_LetMeHave_Implementation
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Asteroids::ShaderSystem::Implementation
+{
+	GLuint theNoiseTexture = 0;
+	std::vector<tbCore::uint8> theNoisePixels;
+
+	inline float Fract(const float value) { return value - std::floor(value); }
+
+	//GLSL mod(), which unlike std::fmod() is always positive for a positive period.
+	inline float Modulo(const float value, const float period) { return value - period * std::floor(value / period); }
+
+	inline tbCore::uint8 ToUnsignedByte(const float value)
+	{
+		return static_cast<tbCore::uint8>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+
+	struct NoiseSample
+	{
+		float mValue;
+		float mDerivativeX;
+		float mDerivativeY;
+	};
+
+	NoiseSample SeamlessNoiseWithDerivatives(const float x, const float y, const float periodX, const float periodY)
+	{
+		const float cellX = std::floor(x);
+		const float cellY = std::floor(y);
+		const float fractionX = x - cellX;
+		const float fractionY = y - cellY;
+
+		const float a = NoiseHash(Modulo(cellX, periodX), Modulo(cellY, periodY));
+		const float b = NoiseHash(Modulo(cellX + 1.0f, periodX), Modulo(cellY, periodY));
+		const float c = NoiseHash(Modulo(cellX, periodX), Modulo(cellY + 1.0f, periodY));
+		const float d = NoiseHash(Modulo(cellX + 1.0f, periodX), Modulo(cellY + 1.0f, periodY));
+
+		const float ux = fractionX * fractionX * (3.0f - 2.0f * fractionX);
+		const float uy = fractionY * fractionY * (3.0f - 2.0f * fractionY);
+		const float dux = 6.0f * fractionX * (1.0f - fractionX);
+		const float duy = 6.0f * fractionY * (1.0f - fractionY);
+
+		const float corners = a - b - c + d;
+		return NoiseSample{
+			a + (b - a) * ux + (c - a) * uy + corners * ux * uy,
+			dux * ((b - a) + corners * uy),
+			duy * ((c - a) + corners * ux),
+		};
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ShaderSystem::FogQuality Asteroids::ShaderSystem::GetFogQuality(void)
+{
+	const tbCore::int64 fogQuality = TheUserSettings().GetInteger(Settings::FogQuality(), 0);
+	return (static_cast<tbCore::int64>(FogQuality::Procedural) == fogQuality) ? FogQuality::Procedural : FogQuality::BakedNoise;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float Asteroids::ShaderSystem::Implementation::NoiseHash(const float x, const float y)
+{
+	const float px = x * 127.1f + y * 311.7f;
+	const float py = x * 269.5f + y * 183.3f;
+	return Fract(std::sin(px * 12.9898f + py * 78.233f) * 43758.5453123f);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float Asteroids::ShaderSystem::Implementation::SeamlessNoise(const float x, const float y, const float periodX, const float periodY)
+{
+	return SeamlessNoiseWithDerivatives(x, y, periodX, periodY).mValue;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+std::vector<tbCore::uint8> Asteroids::ShaderSystem::Implementation::BakeSeamlessNoise(const size_t textureSize, const size_t tileCells)
+{
+	const float period = static_cast<float>(tileCells);
+	const float cellsPerTexel = period / static_cast<float>(textureSize);
+
+	std::vector<tbCore::uint8> pixels(textureSize * textureSize * 4);
+	for (size_t row = 0; row < textureSize; ++row)
+	{
+		for (size_t column = 0; column < textureSize; ++column)
+		{
+			//Sample at the texel centers so the texture returns exactly these values when sampled there.
+			const float x = (static_cast<float>(column) + 0.5f) * cellsPerTexel;
+			const float y = (static_cast<float>(row) + 0.5f) * cellsPerTexel;
+			const NoiseSample sample = SeamlessNoiseWithDerivatives(x, y, period, period);
+
+			tbCore::uint8* pixel = &pixels[(column + row * textureSize) * 4];
+			pixel[0] = ToUnsignedByte(sample.mValue);
+			pixel[1] = ToUnsignedByte(sample.mDerivativeX / 3.0f + 0.5f);
+			pixel[2] = ToUnsignedByte(sample.mDerivativeY / 3.0f + 0.5f);
+			pixel[3] = 255;
+		}
+	}
+
+	return pixels;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float Asteroids::ShaderSystem::Implementation::BakedNoiseScale(const float period, const size_t tileCells)
+{
+	const float tilesPerPeriod = std::max(1.0f, std::floor(period / static_cast<float>(tileCells) + 0.5f));
+	return tilesPerPeriod / period;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::CreateNoiseTexture(void)
+{
+	using namespace Implementation;
+	tb_error_if(0 != theNoiseTexture, "Calling CreateNoiseTexture() with the noise texture already existing.");
+
+	if (true == theNoisePixels.empty())
+	{
+		theNoisePixels = BakeSeamlessNoise(kNoiseTextureSize, kNoiseTileCells);
+	}
+
+	GLStateCache& stateCache = TheGLStateCache();
+
+	tb_check_gl_errors(glGenTextures(1, &theNoiseTexture));
+	stateCache.BindTexture(kNoiseTextureUnit, GL_TEXTURE_2D, theNoiseTexture);
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+	tb_check_gl_errors(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, static_cast<GLsizei>(kNoiseTextureSize),
+		static_cast<GLsizei>(kNoiseTextureSize), 0, GL_RGBA, GL_UNSIGNED_BYTE, theNoisePixels.data()));
+
+	//The higher octaves sample the texture at up to 8x the base frequency, without mips those shimmer.
+	tb_check_gl_errors(glGenerateMipmap(GL_TEXTURE_2D));
+
+	stateCache.BindTexture(kNoiseTextureUnit, GL_TEXTURE_2D, 0);
+	stateCache.SetActiveTextureUnit(0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::DestroyNoiseTexture(void)
+{
+	using namespace Implementation;
+	if (0 != theNoiseTexture)
+	{
+		tb_check_gl_errors(glDeleteTextures(1, &theNoiseTexture));
+		theNoiseTexture = 0;
+	}
+
+	TheGLStateCache().Invalidate();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::BindNoiseTexture(void)
+{
+	tb_error_if(0 == Implementation::theNoiseTexture, "Expected the noise texture to be created before binding it.");
+
+	GLStateCache& stateCache = TheGLStateCache();
+	stateCache.BindTexture(kNoiseTextureUnit, GL_TEXTURE_2D, Implementation::theNoiseTexture);
+	stateCache.SetActiveTextureUnit(0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class NoiseTextureTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		NoiseTextureTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::NoiseTextureTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace ShaderSystem::Implementation;
+
+			const float period = static_cast<float>(ShaderSystem::kNoiseTileCells);
+			for (float x = 0.0f; x < 4.0f; x += 0.37f)
+			{
+				const float noise = SeamlessNoise(x, x * 0.5f, period, period);
+				ExpectedValue(noise >= 0.0f && noise <= 1.0f, true, "Expected the noise to be within 0 to 1.");
+				ExpectedValue(std::fabs(noise - SeamlessNoise(x + period, x * 0.5f, period, period)) < 0.0001f, true,
+					"Expected the noise to tile horizontally.");
+				ExpectedValue(std::fabs(noise - SeamlessNoise(x, x * 0.5f - period, period, period)) < 0.0001f, true,
+					"Expected the noise to tile vertically.");
+			}
+
+			const size_t textureSize = 64;
+			const std::vector<tbCore::uint8> pixels = BakeSeamlessNoise(textureSize, 8);
+			ExpectedValue(pixels.size(), textureSize * textureSize * 4, "Expected an RGBA8 image of the requested size.");
+
+			//The first and last columns are neighbours once the texture repeats, they should step no further than any
+			//other pair of neighbouring columns does.
+			int largestSeam = 0;
+			int largestStep = 0;
+			for (size_t row = 0; row < textureSize; ++row)
+			{
+				const int first = pixels[(row * textureSize) * 4];
+				const int last = pixels[(row * textureSize + textureSize - 1) * 4];
+				largestSeam = std::max(largestSeam, std::abs(first - last));
+
+				for (size_t column = 1; column < textureSize; ++column)
+				{
+					const int left = pixels[(row * textureSize + column - 1) * 4];
+					const int right = pixels[(row * textureSize + column) * 4];
+					largestStep = std::max(largestStep, std::abs(left - right));
+				}
+			}
+			ExpectedValue(largestSeam <= largestStep, true, "Expected no visible seam where the noise texture repeats.");
+
+			//Every period the shader samples with, the baked lookup must repeat with it and keep cells near one unit.
+			const float tileCells = static_cast<float>(ShaderSystem::kNoiseTileCells);
+			for (const float samplePeriod : { tileCells, tileCells * 5.0f, tileCells * 1.8f, tileCells * 3.6f, tileCells * 7.2f })
+			{
+				const float scale = BakedNoiseScale(samplePeriod, ShaderSystem::kNoiseTileCells);
+				const float tilesPerPeriod = scale * samplePeriod;
+				ExpectedValue(std::fabs(tilesPerPeriod - std::round(tilesPerPeriod)) < 0.0001f, true,
+					"Expected a whole number of baked tiles in each period so the noise repeats with it.");
+
+				const float cellWidth = 1.0f / (scale * tileCells);
+				ExpectedValue(cellWidth > 0.75f && cellWidth < 1.5f, true, "Expected the baked cells to stay near one unit wide.");
+			}
+
+			return true;
+		}
+	};
+
+	NoiseTextureTest theNoiseTextureTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,70 @@
+///
+/// @file
+/// @details Bakes the seamless value noise used by the fog of wilderness effect into a tiling texture so the shader
+///   can sample it rather than evaluating the noise for every fragment.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_NoiseTexture_hpp
+#define Asteroids_NoiseTexture_hpp
+
+#include <turtle_brains/core/tb_types.hpp>
+#include <turtle_brains/core/tb_opengl.hpp>
+
+#include <vector>
+
+namespace Asteroids::ShaderSystem
+{
+
+	///
+	/// @details Selected by Settings::FogQuality(); the procedural path evaluates the noise in the shader exactly as it
+	///   always has, the baked path samples the noise texture instead.
+	///
+	enum class FogQuality { BakedNoise, Procedural };
+
+	FogQuality GetFogQuality(void);
+
+	const size_t kNoiseTextureUnit = 1;
+	const size_t kNoiseTextureSize = 256;
+
+	//Must match kNoiseTileCells in fog_of_wilderness_gl3_2.frag, the noise repeats every this many cells.
+	const size_t kNoiseTileCells = 32;
+
+	namespace Implementation
+	{
+		///
+		/// @details CPU versions of hash() and seamlessNoise() from fog_of_wilderness_gl3_2.frag, kept in floats to
+		///   stay as close to the GPU results as reasonable.
+		///
+		float NoiseHash(const float x, const float y);
+		float SeamlessNoise(const float x, const float y, const float periodX, const float periodY);
+
+		///
+		/// @details Bakes noise that tiles every kNoiseTileCells cells into an RGBA8 image that is textureSize texels
+		///   square. Red holds the noise, green and blue hold the partial derivatives in x and y so the curl in the
+		///   shader takes a single fetch, stored as derivative / 3 + 0.5.
+		///
+		std::vector<tbCore::uint8> BakeSeamlessNoise(const size_t textureSize, const size_t tileCells);
+
+		///
+		/// @details CPU version of the texture coordinate scale in sampleNoise(), fog_of_wilderness_gl3_2.frag, which
+		///   fits a whole number of baked tiles into period so the baked noise repeats every period cells.
+		///
+		float BakedNoiseScale(const float period, const size_t tileCells);
+	};
+
+	///
+	/// @details The pixels are baked once on the first call and kept, so a lost graphics context is quick to recover.
+	///
+	void CreateNoiseTexture(void);
+	void DestroyNoiseTexture(void);
+
+	///
+	/// @details Binds the noise texture to kNoiseTextureUnit and leaves texture unit 0 active for TurtleBrains.
+	///
+	void BindNoiseTexture(void);
+
+};	//namespace Asteroids::ShaderSystem
+
+#endif /* Asteroids_NoiseTexture_hpp */
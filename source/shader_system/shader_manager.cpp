@@ -9,6 +9,8 @@
 #include "../shader_system/shader_manager.hpp"
 #include "../shader_system/shader_uniform_object.hpp"
 #include "../shader_system/shaders.hpp"
+#include "../shader_system/uniform_buffer.hpp"
+#include "../shader_system/gl_state_cache.hpp"
 
 #include "../logging.hpp"
 
@@ -276,6 +278,12 @@ bool Asteroids::ShaderSystem::Implementation::DestroyShaderFromOpenGL(ShaderData
 	tb_check_gl_errors(glDeleteShader(shaderData.mVertexShader));
 	tb_check_gl_errors(glDeleteProgram(shaderData.mProgram));
 
+	//The driver may hand the name of the deleted program to the next one created, as it does when a shader is hot
+	//  reloaded, and the cache would then drop the glUseProgram() of the new program as already current. Uniform
+	//  blocks would likewise skip the block binding and layout check of the new program.
+	TheGLStateCache().InvalidateProgram();
+	UniformRingBuffer::InvalidateProgram(shaderData.mProgram);
+
 	shaderData.mProgram = kInvalidOpenGLProgram;
 	shaderData.mGeometryShader = kInvalidOpenGLShader;
 	shaderData.mVertexShader = kInvalidOpenGLShader;
@@ -355,6 +363,7 @@ Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::ShaderManager::Cr
 
 		Implementation::GenerateShaderFromOpenGL(shaderData);
 		shaderHandle = theShaderCache.CreateResource(shaderData, cachedNameString);
+		SetShaderUniform(shaderHandle, "diffuseTexture", 0);
 		tb_debug_log(LogShader::Info() << "Loaded Shader Program:\n\tGeometry: '" << geometryShaderFile <<
 			"'\n\tVertex: '" << vertexShaderFile << "'\n\tFragment: '" << fragmentShaderFile << "'.");
 	}
@@ -383,7 +392,9 @@ Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::ShaderManager::Cr
 
 	Implementation::GenerateShaderFromOpenGL(shaderData, cachedName.mVertexShaderFile,
 		cachedName.mFragmentShaderFile, cachedName.mGeometryShaderFile);
-	return theShaderCache.CreateResource(shaderData, "ShaderFromData" + tb_string(++theDataShaderCount));
+	const ShaderHandle shaderHandle = theShaderCache.CreateResource(shaderData, "ShaderFromData" + tb_string(++theDataShaderCount));
+	SetShaderUniform(shaderHandle, "diffuseTexture", 0);
+	return shaderHandle;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -538,18 +549,19 @@ void Asteroids::ShaderSystem::ShaderManager::BindShader(const ShaderHandle& shad
 		return;
 	}
 
+	// 2026-10-19: The program now goes through the GLStateCache so a bind that lands on the program that is already
+	//   current never reaches the driver. "diffuseTexture" used to be set on every shader, by name, on every bind; it
+	//   never changes so it is now set once when each shader is created.
 	theBoundShader = shaderHandle;
 	if (InvalidShader() == theBoundShader)
 	{
-		tb_check_gl_errors(glUseProgram(theOriginalShaderProgram));
+		TheGLStateCache().UseProgram(theOriginalShaderProgram);
 	}
 	else
 	{
 		const ShaderData& shaderData = theShaderCache.GetResourceReference(shaderHandle);
 		tb_error_if(0 == shaderData.mProgram, "Error: Shader is being bound to invalid shader!?");
-		tb_check_gl_errors(glUseProgram(shaderData.mProgram));
-
-		ShaderSystem::theShaderManager.SetShaderUniform("diffuseTexture", 0);
+		TheGLStateCache().UseProgram(shaderData.mProgram);
 	}
 }
 
@@ -778,6 +790,7 @@ void Asteroids::ShaderSystem::ShaderManager::CreateGraphicsContext(void)
 {
 	tb_error_if(0 != theOriginalShaderProgram, "Expected theOriginalShaderProgram to be in an invalid state.");
 	tb_check_gl_errors(glGetIntegerv(GL_CURRENT_PROGRAM, &theOriginalShaderProgram));
+	TheGLStateCache().Invalidate();
 
 	++Hacks::glContextsCreated;
 
@@ -824,6 +837,7 @@ void Asteroids::ShaderSystem::ShaderManager::DestroyGraphicsContext(void)
 	});
 
 	theOriginalShaderProgram = 0;
+	TheGLStateCache().Invalidate();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -919,6 +933,8 @@ int Asteroids::ShaderSystem::Implementation::LinkShader(ShaderData& shaderData)
 		tb_debug_log(""); //end the entry.
 	}
 
+	VerifyUniformBlockLayouts(programId);
+
 	tbGraphics::Implementation::Renderer::ClearErrors("LinkShader");
 	return programId;
 }
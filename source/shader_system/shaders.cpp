@@ -6,6 +6,9 @@
 ///------------------------------------------------------------------------------------------------------------------///
 
 #include "../shader_system/shaders.hpp"
+#include "../shader_system/noise_texture.hpp"
+#include "../shader_system/star_field_texture.hpp"
+#include "../interface/sdf_font.hpp"
 
 //--------------------------------------------------------------------------------------------------------------------//
 
@@ -13,6 +16,11 @@ Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::theFogOfWildernes
 Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::theSimpleFogShader = InvalidShader();
 Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::theOutlineShader = InvalidShader();
 Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::theUIOutlineShader = InvalidShader();
+Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::theFogUpsampleShader = InvalidShader();
+Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::theSpaceBackdropShader = InvalidShader();
+Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::theParticleShader = InvalidShader();
+Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::theSdfShapeShader = InvalidShader();
+Asteroids::ShaderSystem::ShaderHandle Asteroids::ShaderSystem::theSdfTextShader = InvalidShader();
 
 //--------------------------------------------------------------------------------------------------------------------//
 
@@ -33,6 +41,11 @@ namespace Asteroids::ShaderSystem::Implementation
 		{ &theSimpleFogShader, { "fog_gl3_2.vert", "fog_gl3_2.frag" } },
 		{ &theOutlineShader, { "fog_gl3_2.vert", "outline_gl3_2.frag" } },
 		{ &theUIOutlineShader, { "fog_gl3_2.vert", "ui_outline_gl3_2.frag" } },
+		{ &theFogUpsampleShader, { "fog_gl3_2.vert", "fog_upsample_gl3_2.frag" } },
+		{ &theSpaceBackdropShader, { "fog_gl3_2.vert", "space_backdrop_gl3_2.frag" } },
+		{ &theParticleShader, { "particle_gl3_2.vert", "particle_gl3_2.frag" } },
+		{ &theSdfShapeShader, { "fog_gl3_2.vert", "sdf_shape_gl3_2.frag" } },
+		{ &theSdfTextShader, { "fog_gl3_2.vert", "sdf_text_gl3_2.frag" } },
 	};
 };
 
@@ -61,12 +74,25 @@ void Asteroids::ShaderSystem::CreateShaders(void)
 	theShaderManager.SetShaderUniform("uSecondaryColor", Vector3(0.1f, 0.2f, 0.2f));
 	theShaderManager.SetShaderUniform("uFogSize", Vector2(0.0f, 0.0f));
 	theShaderManager.SetShaderUniform("uScreenSize", Vector2(0.0f, 0.0f));
+	theShaderManager.SetShaderUniform("uFullResolutionWidth", 1920.0f);
+	theShaderManager.SetShaderUniform("uTargetHeight", 1080.0f);
 	theShaderManager.SetShaderUniform("uFogDirection", Vector2(0.3f, -0.3f));
 	theShaderManager.SetShaderUniform("uForceTransparency", false);
 	theShaderManager.SetShaderUniform("uFogTransparency", 0.1f);
 	theShaderManager.SetShaderUniform("uFogSpeed", 0.3f);
 	theShaderManager.SetShaderUniform("outlineThickness", 0.04f);
 	theShaderManager.SetShaderUniform("uTime", 0.0f);
+	theShaderManager.SetShaderUniform("uNoiseTexture", static_cast<int>(kNoiseTextureUnit));
+	theShaderManager.SetShaderUniform("uProceduralNoise", FogQuality::Procedural == GetFogQuality());
+	theShaderManager.SetShaderUniform("uUpsampleSharpness", 8.0f);
+	theShaderManager.SetShaderUniform("uStarFieldTexture", static_cast<int>(kStarFieldTextureUnit));
+	theShaderManager.SetShaderUniform("uWorldToClip", Vector4(0.0f, 0.0f, 0.0f, 0.0f));
+	theShaderManager.SetShaderUniform("uPointScale", 1.0f);
+	theShaderManager.SetShaderUniform("uShapeSize", Vector4(0.0f, 0.0f, 0.0f, 0.0f));
+	theShaderManager.SetShaderUniform("uShapeCorners", Vector4(0.0f, 0.0f, 0.0f, 0.0f));
+	theShaderManager.SetShaderUniform("uShapeArc", Vector4(0.0f, 0.0f, 0.0f, 0.0f));
+	theShaderManager.SetShaderUniform("uShapeBorderColor", Vector4(0.0f, 0.0f, 0.0f, 0.0f));
+	theShaderManager.SetShaderUniform("uFontAtlas", static_cast<int>(Interface::kSdfFontTextureUnit));
 
 	// Common Uniforms, should kinda be set by engine but shaders aren't really in TurtleBrains.
 	theShaderManager.SetShaderUniform("uObjectToProjection", Matrix4::Identity());
@@ -9,6 +9,7 @@
 #define Asteroids_Shaders_hpp
 
 #include "../shader_system/shader_manager.hpp"
+#include "../shader_system/std140.hpp"
 
 namespace Asteroids::ShaderSystem
 {
@@ -17,10 +18,56 @@ namespace Asteroids::ShaderSystem
 	extern ShaderHandle theSimpleFogShader;
 	extern ShaderHandle theOutlineShader;
 	extern ShaderHandle theUIOutlineShader;
+	extern ShaderHandle theFogUpsampleShader;
+	extern ShaderHandle theSpaceBackdropShader;
+	extern ShaderHandle theParticleShader;
+	extern ShaderHandle theSdfShapeShader;
+	extern ShaderHandle theSdfTextShader;
 
 	void CreateShaders(void);
 	void DestroyShaders(void);
 
+	///
+	/// @details Matches ubFogOfWilderness in fog_of_wilderness_gl3_2.frag, to be used with UniformBlock<>.
+	///
+	struct FogOfWildernessBlock
+	{
+		Std140::Array<Std140::Vec4, 512> mFog;
+	};
+
+	///
+	/// @details Matches ubSpaceBackdrop in space_backdrop_gl3_2.frag, to be used with UniformBlock<>.
+	///
+	struct SpaceBackdropBlock
+	{
+		Std140::Array<Std140::Vec4, 4> mLayerTransforms; //xy offset in world pixels, z world pixels per texel, w texture
+		Std140::Array<Std140::Vec4, 4> mLayerTints;      //premultiplied rgba
+		Std140::Vec4 mBackdrop;                          //xy world size in pixels, z layer count
+	};
+
+}; /* namespace Asteroids::ShaderSystem */
+
+namespace Asteroids::ShaderSystem::Std140
+{
+
+	template<> struct BlockLayout<FogOfWildernessBlock>
+	{
+		static constexpr std::string_view kBlockName = "ubFogOfWilderness";
+		static constexpr std::array kMembers = {
+			asteroids_std140_member(FogOfWildernessBlock, mFog, "fog[0]"),
+		};
+	};
+
+	template<> struct BlockLayout<SpaceBackdropBlock>
+	{
+		static constexpr std::string_view kBlockName = "ubSpaceBackdrop";
+		static constexpr std::array kMembers = {
+			asteroids_std140_member(SpaceBackdropBlock, mLayerTransforms, "layerTransforms[0]"),
+			asteroids_std140_member(SpaceBackdropBlock, mLayerTints, "layerTints[0]"),
+			asteroids_std140_member(SpaceBackdropBlock, mBackdrop, "backdrop"),
+		};
+	};
+
 }; /* namespace Asteroids::ShaderSystem */
 
 #endif /* Asteroids_Shaders_hpp */
@@ -0,0 +1,219 @@
+///
+/// @file
+/// @details Scatters the stars of the space backdrop into a tiling texture once at load, so the backdrop shader can
+///   sample every star layer from it instead of drawing each star or each layer on its own.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../shader_system/star_field_texture.hpp"
+#include "../shader_system/gl_state_cache.hpp"
+
+// 2025-11-19: The ShaderSystem Implementation depends on the TurtleBrains renderer, for check_gl_errors and other
+//   implementation details. We 'know what we are doing'.
+#define TurtleBrains_LetMeHave_Implementation
+#include <turtle_brains/graphics/implementation/tbi_renderer.hpp>
+#undef TurtleBrains_LetMeHave_Implementation
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Asteroids::ShaderSystem::Implementation
+{
+	GLuint theStarFieldTexture = 0;
+	std::vector<tbCore::uint8> theStarFieldPixels;
+
+	const tbCore::uint32 kStarFieldSeed = 0x5747A125;
+
+	//A tiny xorshift so the field is the same on every platform, tbMath::Random would also disturb gameplay rolls.
+	class StarRandom
+	{
+	public:
+		explicit StarRandom(const tbCore::uint32 seed) :
+			mState((0 == seed) ? 1 : seed)
+		{
+		}
+
+		float NextFloat(const float minimum, const float maximum)
+		{
+			mState ^= mState << 13;
+			mState ^= mState >> 17;
+			mState ^= mState << 5;
+			return minimum + (maximum - minimum) * static_cast<float>(mState >> 8) / static_cast<float>(1 << 24);
+		}
+
+	private:
+		tbCore::uint32 mState;
+	};
+
+	inline tbCore::uint8 ToUnsignedByte(const float value)
+	{
+		return static_cast<tbCore::uint8>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::Implementation::SplatStar(std::vector<tbCore::uint8>& pixels, const size_t textureSize,
+	const float x, const float y, const float radius, const float brightness)
+{
+	const int size = static_cast<int>(textureSize);
+	const int reach = static_cast<int>(std::ceil(radius * 2.0f));
+	const int centerColumn = static_cast<int>(std::floor(x));
+	const int centerRow = static_cast<int>(std::floor(y));
+
+	for (int row = centerRow - reach; row <= centerRow + reach; ++row)
+	{
+		for (int column = centerColumn - reach; column <= centerColumn + reach; ++column)
+		{
+			const float offsetX = (static_cast<float>(column) + 0.5f) - x;
+			const float offsetY = (static_cast<float>(row) + 0.5f) - y;
+			const float coverage = brightness * std::exp(-(offsetX * offsetX + offsetY * offsetY) / (radius * radius));
+			if (coverage < 1.0f / 255.0f)
+			{
+				continue;
+			}
+
+			const size_t wrappedColumn = static_cast<size_t>((column % size + size) % size);
+			const size_t wrappedRow = static_cast<size_t>((row % size + size) % size);
+			tbCore::uint8* pixel = &pixels[(wrappedColumn + wrappedRow * textureSize) * 4];
+
+			const tbCore::uint8 value = ToUnsignedByte(coverage);
+			pixel[0] = std::max(pixel[0], value);
+			pixel[1] = std::max(pixel[1], value);
+			pixel[2] = std::max(pixel[2], value);
+			pixel[3] = std::max(pixel[3], value);
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+std::vector<tbCore::uint8> Asteroids::ShaderSystem::Implementation::BakeStarField(const size_t textureSize,
+	const size_t starCount, const tbCore::uint32 seed)
+{
+	std::vector<tbCore::uint8> pixels(textureSize * textureSize * 4, 0);
+	const float size = static_cast<float>(textureSize);
+
+	StarRandom random(seed);
+	for (size_t starIndex = 0; starIndex < starCount; ++starIndex)
+	{
+		const float x = random.NextFloat(0.0f, size);
+		const float y = random.NextFloat(0.0f, size);
+
+		//Most stars are faint specks, a few are bigger and brighter.
+		const float magnitude = random.NextFloat(0.0f, 1.0f);
+		const float radius = 0.5f + 1.2f * magnitude * magnitude * magnitude;
+		const float brightness = 0.35f + 0.65f * magnitude;
+		SplatStar(pixels, textureSize, x, y, radius, brightness);
+	}
+
+	return pixels;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::CreateStarFieldTexture(void)
+{
+	using namespace Implementation;
+	tb_error_if(0 != theStarFieldTexture, "Calling CreateStarFieldTexture() with the star field texture already existing.");
+
+	if (true == theStarFieldPixels.empty())
+	{
+		theStarFieldPixels = BakeStarField(kStarFieldTextureSize, kStarFieldStarCount, kStarFieldSeed);
+	}
+
+	GLStateCache& stateCache = TheGLStateCache();
+
+	tb_check_gl_errors(glGenTextures(1, &theStarFieldTexture));
+	stateCache.BindTexture(kStarFieldTextureUnit, GL_TEXTURE_2D, theStarFieldTexture);
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR));
+	tb_check_gl_errors(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+	tb_check_gl_errors(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, static_cast<GLsizei>(kStarFieldTextureSize),
+		static_cast<GLsizei>(kStarFieldTextureSize), 0, GL_RGBA, GL_UNSIGNED_BYTE, theStarFieldPixels.data()));
+
+	//Distant layers sample the stars smaller than a texel, without mips they sparkle as the backdrop scrolls.
+	tb_check_gl_errors(glGenerateMipmap(GL_TEXTURE_2D));
+
+	stateCache.BindTexture(kStarFieldTextureUnit, GL_TEXTURE_2D, 0);
+	stateCache.SetActiveTextureUnit(0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::DestroyStarFieldTexture(void)
+{
+	using namespace Implementation;
+	if (0 != theStarFieldTexture)
+	{
+		tb_check_gl_errors(glDeleteTextures(1, &theStarFieldTexture));
+		theStarFieldTexture = 0;
+	}
+
+	TheGLStateCache().Invalidate();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::BindStarFieldTexture(void)
+{
+	tb_error_if(0 == Implementation::theStarFieldTexture, "Expected the star field texture to be created before binding it.");
+
+	GLStateCache& stateCache = TheGLStateCache();
+	stateCache.BindTexture(kStarFieldTextureUnit, GL_TEXTURE_2D, Implementation::theStarFieldTexture);
+	stateCache.SetActiveTextureUnit(0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class StarFieldTextureTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		StarFieldTextureTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::StarFieldTextureTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace ShaderSystem::Implementation;
+
+			const size_t textureSize = 64;
+			const std::vector<tbCore::uint8> pixels = BakeStarField(textureSize, 40, 1234);
+			ExpectedValue(pixels.size(), textureSize * textureSize * 4, "Expected an RGBA8 image of the requested size.");
+			ExpectedValue(pixels == BakeStarField(textureSize, 40, 1234), true, "Expected the same seed to give the same stars.");
+			ExpectedValue(pixels == BakeStarField(textureSize, 40, 4321), false, "Expected another seed to give other stars.");
+
+			size_t litTexels = 0;
+			for (size_t texelIndex = 0; texelIndex < textureSize * textureSize; ++texelIndex)
+			{
+				litTexels += (0 != pixels[texelIndex * 4 + 3]) ? 1 : 0;
+			}
+			ExpectedValue(litTexels > 40 && litTexels < textureSize * textureSize / 2, true, "Expected a sparse field of stars.");
+
+			{	//A star on the left edge must continue on the right edge once the texture repeats.
+				std::vector<tbCore::uint8> edgePixels(textureSize * textureSize * 4, 0);
+				SplatStar(edgePixels, textureSize, 0.25f, 10.5f, 1.0f, 1.0f);
+				ExpectedValue(0 != edgePixels[(0 + 10 * textureSize) * 4 + 3], true, "Expected the star at its own texel.");
+				ExpectedValue(0 != edgePixels[(textureSize - 1 + 10 * textureSize) * 4 + 3], true, "Expected the star to wrap around.");
+			}
+
+			return true;
+		}
+	};
+
+	StarFieldTextureTest theStarFieldTextureTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,53 @@
+///
+/// @file
+/// @details Scatters the stars of the space backdrop into a tiling texture once at load, so the backdrop shader can
+///   sample every star layer from it instead of drawing each star or each layer on its own.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_StarFieldTexture_hpp
+#define Asteroids_StarFieldTexture_hpp
+
+#include <turtle_brains/core/tb_types.hpp>
+#include <turtle_brains/core/tb_opengl.hpp>
+
+#include <vector>
+
+namespace Asteroids::ShaderSystem
+{
+
+	const size_t kStarFieldTextureUnit = 2;
+	const size_t kStarFieldTextureSize = 512;
+	const size_t kStarFieldStarCount = 600;
+
+	namespace Implementation
+	{
+		///
+		/// @details Adds a single soft star into an RGBA8 image that is textureSize texels square, wrapping around the
+		///   edges so the texture still tiles. Overlapping stars keep the brighter of the two.
+		///
+		void SplatStar(std::vector<tbCore::uint8>& pixels, const size_t textureSize, const float x, const float y,
+			const float radius, const float brightness);
+
+		///
+		/// @details Scatters starCount stars, the same seed always gives the same field. The color is stored with the
+		///   alpha already multiplied in, alpha holds how much of the star covers the texel.
+		///
+		std::vector<tbCore::uint8> BakeStarField(const size_t textureSize, const size_t starCount, const tbCore::uint32 seed);
+	};
+
+	///
+	/// @details The pixels are baked once on the first call and kept, so a lost graphics context is quick to recover.
+	///
+	void CreateStarFieldTexture(void);
+	void DestroyStarFieldTexture(void);
+
+	///
+	/// @details Binds the star field texture to kStarFieldTextureUnit and leaves texture unit 0 active for TurtleBrains.
+	///
+	void BindStarFieldTexture(void);
+
+};	//namespace Asteroids::ShaderSystem
+
+#endif /* Asteroids_StarFieldTexture_hpp */
@@ -0,0 +1,148 @@
+///
+/// @file
+/// @details Provides the types used to describe a uniform block with a C++ struct so the layout can be checked against
+///   the std140 rules at compile time, and against the linked program when the shader is linked.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_Std140_hpp
+#define Asteroids_Std140_hpp
+
+#include <turtle_brains/core/tb_types.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+namespace Asteroids::ShaderSystem::Std140
+{
+	// There is intentionally no vec3. The std140 rules align a vec3 to 16 bytes but let a following scalar pack into
+	//   the last 4 bytes, which is a classic source of mismatched layouts. Use Vec4 and ignore w instead.
+
+	using Float = float;
+	using Int = tbCore::int32;
+	using UnsignedInt = tbCore::uint32;
+
+	struct alignas(8) Vec2
+	{
+		float x;
+		float y;
+	};
+
+	struct alignas(16) Vec4
+	{
+		float x;
+		float y;
+		float z;
+		float w;
+	};
+
+	struct alignas(16) Matrix4
+	{
+		float mComponents[16];
+	};
+
+	///
+	/// @details In std140 every array element is rounded up to the alignment of a vec4, so an array of floats has a
+	///   stride of 16 bytes rather than 4.
+	///
+	template<typename Type, size_t Count> struct Array
+	{
+		struct alignas(16) Element
+		{
+			Type mValue;
+		};
+
+		inline Type& operator[](const size_t index) { return mElements[index].mValue; }
+		inline const Type& operator[](const size_t index) const { return mElements[index].mValue; }
+		inline constexpr size_t size(void) const { return Count; }
+
+		Element mElements[Count];
+	};
+
+	static_assert(sizeof(Vec2) == 8 && alignof(Vec2) == 8, "Std140 Vec2 must be 8 bytes with 8 byte alignment.");
+	static_assert(sizeof(Vec4) == 16 && alignof(Vec4) == 16, "Std140 Vec4 must be 16 bytes with 16 byte alignment.");
+	static_assert(sizeof(Matrix4) == 64 && alignof(Matrix4) == 16, "Std140 Matrix4 must be 64 bytes with 16 byte alignment.");
+	static_assert(sizeof(Array<Float, 4>) == 64, "Std140 Array elements must have a stride of 16 bytes.");
+	static_assert(sizeof(Array<Vec2, 4>) == 64, "Std140 Array elements must have a stride of 16 bytes.");
+
+	///
+	/// @details The std140 base alignment and size of each type a block may hold, which is what GLSL lays the block out
+	///   by, rather than the C++ alignof() and sizeof(). Any other type in a block is a compile error.
+	///
+	template<typename Type> struct TypeRules;
+
+	template<> struct TypeRules<Float> { static constexpr size_t kBaseAlignment = 4; static constexpr size_t kSize = 4; };
+	template<> struct TypeRules<Int> { static constexpr size_t kBaseAlignment = 4; static constexpr size_t kSize = 4; };
+	template<> struct TypeRules<UnsignedInt> { static constexpr size_t kBaseAlignment = 4; static constexpr size_t kSize = 4; };
+	template<> struct TypeRules<Vec2> { static constexpr size_t kBaseAlignment = 8; static constexpr size_t kSize = 8; };
+	template<> struct TypeRules<Vec4> { static constexpr size_t kBaseAlignment = 16; static constexpr size_t kSize = 16; };
+
+	//A matrix is laid out as an array of its column vectors, four vec4s.
+	template<> struct TypeRules<Matrix4> { static constexpr size_t kBaseAlignment = 16; static constexpr size_t kSize = 64; };
+
+	//The alignment and stride of an array are those of its element rounded up to a vec4.
+	template<typename Type, size_t Count> struct TypeRules<Array<Type, Count>>
+	{
+		static constexpr size_t kStride = (TypeRules<Type>::kSize + 15) / 16 * 16;
+		static constexpr size_t kBaseAlignment = 16;
+		static constexpr size_t kSize = kStride * Count;
+
+		static_assert(sizeof(Array<Type, Count>) == kSize, "Std140 Array must match the std140 array stride.");
+	};
+
+	///
+	/// @details Describes a single member of a uniform block; mName is the name reported by the GL reflection, so an
+	///   array member is named like "fog[0]". The alignment and size are the std140 ones from TypeRules.
+	///
+	struct Member
+	{
+		std::string_view mName;
+		size_t mOffset;
+		size_t mAlignment;
+		size_t mSize;
+	};
+
+	///
+	/// @details Specialize this for each block struct, after the struct is complete, providing:
+	///     static constexpr std::string_view kBlockName = "ubNameInShader";
+	///     static constexpr std::array kMembers = { asteroids_std140_member(BlockType, mMember, "nameInShader"), ... };
+	///
+	template<typename BlockType> struct BlockLayout;
+
+	///
+	/// @details True when every member, listed in declaration order, sits exactly where std140 places it: at the end
+	///   of the previous member rounded up to its base alignment. The block must also be padded to 16 bytes.
+	///
+	template<typename BlockType> constexpr bool IsValidLayout(void)
+	{
+		if (0 != sizeof(BlockType) % 16)
+		{
+			return false;
+		}
+
+		size_t previousEnd = 0;
+		for (const Member& member : BlockLayout<BlockType>::kMembers)
+		{
+			const size_t std140Offset = (previousEnd + member.mAlignment - 1) / member.mAlignment * member.mAlignment;
+			if (member.mOffset != std140Offset || member.mOffset + member.mSize > sizeof(BlockType))
+			{
+				return false;
+			}
+
+			previousEnd = member.mOffset + member.mSize;
+		}
+
+		return true;
+	}
+
+};	//namespace Asteroids::ShaderSystem::Std140
+
+#define asteroids_std140_member(BlockType, member, nameInShader) ::Asteroids::ShaderSystem::Std140::Member{ \
+	nameInShader, offsetof(BlockType, member), \
+	::Asteroids::ShaderSystem::Std140::TypeRules<decltype(BlockType::member)>::kBaseAlignment, \
+	::Asteroids::ShaderSystem::Std140::TypeRules<decltype(BlockType::member)>::kSize }
+
+#endif /* Asteroids_Std140_hpp */
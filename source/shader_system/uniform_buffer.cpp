@@ -9,6 +9,7 @@
 
 #include "../shader_system/uniform_buffer.hpp"
 #include "../shader_system/shader_manager.hpp" //For ShaderHandle and Getting the ProgramID
+#include "../logging.hpp"
 
 // 2025-11-19: The ShaderSystem Implementation depends on the TurtleBrains renderer, for check_gl_errors and other
 //   implementation details. We 'know what we are doing'.
@@ -16,46 +17,74 @@
 #include <turtle_brains/graphics/implementation/tbi_renderer.hpp>
 #undef TurtleBrains_LetMeHave_Implementation
 
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
 #include <list>
+#include <vector>
 
 namespace Asteroids::ShaderSystem::Implementation
 {
-	//Exists in shader_manager.cpp
-	tbCore::uint32 ShaderHandleToProgramID(const ShaderHandle& shaderHandle);
+	// 2026-10-19: A region that is still in flight after this long is almost certainly a lost fence, don't hang forever.
+	const GLuint64 kMaximumFenceWait = 100000000; //nanoseconds, 100ms
 
-	std::list<UniformBuffer*>& GetAllUniformBuffers(void)
+	const size_t kUniformRowBytes = 16;
+	size_t theUniformBytesUploaded = 0;
+
+	struct UniformBlockLayout
+	{
+		String mBlockName;
+		size_t mBlockSize;
+		std::vector<Std140::Member> mMembers;
+	};
+
+	bool IsBufferStorageSupported(void)
+	{
+#if defined(tb_web)
+		return false;
+#else
+		return (GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage);
+#endif /* tb_web */
+	}
+
+	std::list<UniformRingBuffer*>& GetAllUniformBuffers(void)
 	{
-		static std::list<UniformBuffer*> allUniformBuffers;
+		static std::list<UniformRingBuffer*> allUniformBuffers;
 		return allUniformBuffers;
 	}
+
+	std::vector<UniformBlockLayout>& GetAllUniformBlockLayouts(void)
+	{
+		static std::vector<UniformBlockLayout> allUniformBlockLayouts;
+		return allUniformBlockLayouts;
+	}
 };
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-Asteroids::ShaderSystem::UniformBuffer::UniformBuffer(void) :
+Asteroids::ShaderSystem::Implementation::UniformRingBuffer::UniformRingBuffer(const size_t regionBytes) :
 	tbCore::Noncopyable(),
-	kBatchSize(2048),
-	kElementSize(sizeof(Type)),
+	mRegionBytes(regionBytes),
 	mUniformBuffer(0),
-	mBufferData(),
-	mWriteIndex(0)
+	mRegionStride(0),
+	mPersistentData(nullptr),
+	mFences(),
+	mActiveRegion(0),
+	mIsMapped(false),
+	mIsBound(false),
+	mContentsLost(true),
+	mBlockIndices()
 {
-	ShaderSystem::Implementation::GetAllUniformBuffers().push_back(this);
-
-	int maximumUniformBytes = 0;
-	tb_check_gl_errors(glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &maximumUniformBytes));
-	const GLint totalRequiredBytes = tbCore::size(kBatchSize * kElementSize);
-	tb_error_if(maximumUniformBytes < totalRequiredBytes, "ShaderError: This GPU does not have a large enough block size available.");
-
-	tb_check_gl_errors(glGenBuffers(1, &mUniformBuffer));
-	tb_check_gl_errors(glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer));
-	tb_check_gl_errors(glBufferData(GL_UNIFORM_BUFFER, totalRequiredBytes, nullptr, GL_DYNAMIC_DRAW));
+	mFences.fill(nullptr);
+	GetAllUniformBuffers().push_back(this);
+	CreateBuffer();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-Asteroids::ShaderSystem::UniformBuffer::~UniformBuffer(void)
+Asteroids::ShaderSystem::Implementation::UniformRingBuffer::~UniformRingBuffer(void)
 {
 	// 2025-11-13: Allov discovered a small leak without this happening, because we are recreating the UniformBuffer
 	//   object every frame and copying the contents of the fog values into it. That actually means the following
@@ -63,138 +92,509 @@ Asteroids::ShaderSystem::UniformBuffer::~UniformBuffer(void)
 	//   are wrong since the UniformBuffer won't outlive the SupplyRun::Render() function. This fix wouldn't really
 	//   work as-is in ICE, nor would it work terribly well if the UniformBuffer was an object that had lifetime
 	//   outside that function, then again the leak would be much smaller in those cases.
+	//
+	// 2026-10-19: The buffers now live beyond a single Render() and OnDestroyGraphicsContext() releases them before
+	//   the context goes away, so DestroyBuffer() is a no-op if that already happened.
 
 	////This would be called when the GL context has already died, so we can't really clean it up.
 	////Trust that the system will? (This code initially came from the ParticleManager)
+	DestroyBuffer();
+
+	GetAllUniformBuffers().remove(this);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::OnCreateGraphicsContext(void)
+{
+	for (UniformRingBuffer* uniformBuffer : GetAllUniformBuffers())
+	{
+		uniformBuffer->CreateBuffer();
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::OnDestroyGraphicsContext(void)
+{
+	for (UniformRingBuffer* uniformBuffer : GetAllUniformBuffers())
+	{
+		uniformBuffer->DestroyBuffer();
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::InvalidateProgram(const tbCore::uint32 shaderProgramID)
+{
+	for (UniformRingBuffer* uniformBuffer : GetAllUniformBuffers())
+	{
+		std::map<std::pair<tbCore::uint32, StringView>, GLuint>& blockIndices = uniformBuffer->mBlockIndices;
+		for (auto blockIterator = blockIndices.begin(); blockIterator != blockIndices.end(); )
+		{
+			blockIterator = (shaderProgramID == blockIterator->first.first) ? blockIndices.erase(blockIterator) : std::next(blockIterator);
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t Asteroids::ShaderSystem::Implementation::UniformRingBuffer::GetBytesUploaded(void)
+{
+	return theUniformBytesUploaded;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::ResetBytesUploaded(void)
+{
+	theUniformBytesUploaded = 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::CreateBuffer(void)
+{
+	if (0 != mUniformBuffer || false == tbGraphics::Implementation::Renderer::tbiIsRendererAvailable)
+	{
+		return;
+	}
+
+	int maximumUniformBytes = 0;
+	tb_check_gl_errors(glGetIntegerv(GL_MAX_UNIFORM_BLOCK_SIZE, &maximumUniformBytes));
+	const GLint totalRequiredBytes = tbCore::size(mRegionBytes);
+	tb_error_if(maximumUniformBytes < totalRequiredBytes, "ShaderError: This GPU does not have a large enough block size available.");
+
+	//Each region must start on an offset the driver allows for glBindBufferRange().
+	int offsetAlignment = 256;
+	tb_check_gl_errors(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment));
+	offsetAlignment = std::max(offsetAlignment, 1);
+	mRegionStride = ((totalRequiredBytes + offsetAlignment - 1) / offsetAlignment) * offsetAlignment;
+	const GLsizeiptr totalBufferBytes = mRegionStride * static_cast<GLsizeiptr>(kRegionCount);
+
+	tb_check_gl_errors(glGenBuffers(1, &mUniformBuffer));
+	tb_check_gl_errors(glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer));
+
+#if !defined(tb_web)
+	if (true == IsBufferStorageSupported())
+	{
+		const GLbitfield storageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		tb_check_gl_errors(glBufferStorage(GL_UNIFORM_BUFFER, totalBufferBytes, nullptr, storageFlags));
+		tb_check_gl_errors(mPersistentData = reinterpret_cast<tbCore::uint8*>(
+			glMapBufferRange(GL_UNIFORM_BUFFER, 0, totalBufferBytes, storageFlags)));
+	}
+	else
+#endif /* !tb_web */
+	{
+		tb_check_gl_errors(glBufferData(GL_UNIFORM_BUFFER, totalBufferBytes, nullptr, GL_DYNAMIC_DRAW));
+		mPersistentData = nullptr;
+	}
+
+	tb_check_gl_errors(glBindBuffer(GL_UNIFORM_BUFFER, 0));
+
+	mActiveRegion = 0;
+	mContentsLost = true;
+	mBlockIndices.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::DestroyBuffer(void)
+{
+	if (0 == mUniformBuffer)
+	{
+		return;
+	}
+
+	for (GLsync& fence : mFences)
+	{
+		if (nullptr != fence)
+		{
+			tb_check_gl_errors(glDeleteSync(fence));
+			fence = nullptr;
+		}
+	}
+
+	if (nullptr != mPersistentData || true == mIsMapped)
+	{
+		tb_check_gl_errors(glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer));
+		tb_check_gl_errors(glUnmapBuffer(GL_UNIFORM_BUFFER));
+		mPersistentData = nullptr;
+		mIsMapped = false;
+	}
+
 	tb_check_gl_errors(glDeleteBuffers(1, &mUniformBuffer));
 	tb_check_gl_errors(glBindBuffer(GL_UNIFORM_BUFFER, 0));
 	mUniformBuffer = 0;
+	mBlockIndices.clear();
+}
 
-	ShaderSystem::Implementation::GetAllUniformBuffers().remove(this);
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::AdvanceRegion(void)
+{
+	tb_error_if(true == mIsBound, "UniformBuffer must be unbound before moving to the next region.");
+	tb_error_if(true == mIsMapped, "UniformBuffer region must be unmapped before moving to the next region.");
+	mActiveRegion = (mActiveRegion + 1) % kRegionCount;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::ShaderSystem::UniformBuffer::OnCreateGraphicsContext(void)
+bool Asteroids::ShaderSystem::Implementation::UniformRingBuffer::AcquireActiveRegion(void)
 {
+	tb_error_if(0 == mUniformBuffer, "UniformBuffer has not been properly created, or was somehow lost.");
+
+	GLsync& fence = mFences[mActiveRegion];
+	if (nullptr != fence)
+	{
+		//The region was last used kRegionCount binds ago so this should practically never have to wait, but when not
+		//persistently mapped it is cheaper to orphan the buffer than to stall on it.
+		const bool allowBlocking = (nullptr != mPersistentData);
+
+		GLenum waitResult = GL_TIMEOUT_EXPIRED;
+		tb_check_gl_errors(waitResult = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+			(true == allowBlocking) ? kMaximumFenceWait : 0));
+
+		if (GL_ALREADY_SIGNALED == waitResult || GL_CONDITION_SATISFIED == waitResult)
+		{
+			tb_check_gl_errors(glDeleteSync(fence));
+			fence = nullptr;
+		}
+		else if (true == allowBlocking)
+		{
+			tb_debug_log(LogShader::Warning() << "UniformBuffer waited the maximum time on a fence, continuing anyway.");
+			tb_check_gl_errors(glDeleteSync(fence));
+			fence = nullptr;
+		}
+		else
+		{
+			tb_check_gl_errors(glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer));
+			tb_check_gl_errors(glBufferData(GL_UNIFORM_BUFFER, mRegionStride * static_cast<GLsizeiptr>(kRegionCount),
+				nullptr, GL_DYNAMIC_DRAW));
+			tb_check_gl_errors(glBindBuffer(GL_UNIFORM_BUFFER, 0));
+
+			for (GLsync& otherFence : mFences)
+			{
+				if (nullptr != otherFence)
+				{
+					tb_check_gl_errors(glDeleteSync(otherFence));
+					otherFence = nullptr;
+				}
+			}
+
+			mContentsLost = true;
+		}
+	}
+
+	const bool contentsLost = mContentsLost;
+	mContentsLost = false;
+	return contentsLost;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::ShaderSystem::UniformBuffer::OnDestroyGraphicsContext(void)
+tbCore::uint8* Asteroids::ShaderSystem::Implementation::UniformRingBuffer::MapActiveRegion(const size_t byteOffset, const size_t byteCount)
 {
-	//mData = nullptr;
+	tb_error_if(byteOffset + byteCount > mRegionBytes, "UniformBuffer cannot map beyond the end of the region.");
+	tb_error_if(true == mIsMapped, "UniformBuffer region is already mapped.");
+
+	const GLintptr regionOffset = mRegionStride * static_cast<GLintptr>(mActiveRegion);
+	mIsMapped = true;
+	theUniformBytesUploaded += byteCount;
+
+	if (nullptr != mPersistentData)
+	{
+		return mPersistentData + regionOffset + byteOffset;
+	}
+
+	//AcquireActiveRegion() already made sure the GPU is done with this region, so there is no need to synchronize.
+	tbCore::uint8* regionData = nullptr;
+	tb_check_gl_errors(glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffer));
+	tb_check_gl_errors(regionData = reinterpret_cast<tbCore::uint8*>(glMapBufferRange(GL_UNIFORM_BUFFER,
+		regionOffset + byteOffset, byteCount, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT)));
+	return regionData;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::ShaderSystem::UniformBuffer::Clear(void)
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::UnmapActiveRegion(void)
 {
-	mWriteIndex = 0;
+	tb_error_if(false == mIsMapped, "UniformBuffer region is not mapped.");
+	mIsMapped = false;
+
+	if (nullptr == mPersistentData)
+	{
+		tb_check_gl_errors(glUnmapBuffer(GL_UNIFORM_BUFFER));
+		tb_check_gl_errors(glBindBuffer(GL_UNIFORM_BUFFER, 0));
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+GLuint Asteroids::ShaderSystem::Implementation::UniformRingBuffer::GetUniformBlockIndex(const tbCore::uint32 shaderProgramID,
+	const StringView& uniformBlockName)
+{
+	const auto key = std::make_pair(shaderProgramID, uniformBlockName);
+	const auto blockIterator = mBlockIndices.find(key);
+	if (blockIterator != mBlockIndices.end())
+	{
+		return blockIterator->second;
+	}
+
+	//Only on the first bind with each program, a view need not be null terminated so GL gets a copy.
+	const String blockName(uniformBlockName);
+	GLuint blockIndex = GL_INVALID_INDEX;
+	tb_check_gl_errors(blockIndex = glGetUniformBlockIndex(shaderProgramID, blockName.c_str()));
+	if (GL_INVALID_INDEX != blockIndex)
+	{
+		tb_check_gl_errors(glUniformBlockBinding(shaderProgramID, blockIndex, 0));
+
+		//LinkShader() checks the layouts registered at that time, this catches blocks registered later on.
+		VerifyUniformBlockLayout(shaderProgramID, blockName);
+	}
+
+	mBlockIndices[key] = blockIndex;
+	return blockIndex;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-bool Asteroids::ShaderSystem::UniformBuffer::PushData(const Type& data)
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::Bind(const tbCore::uint32 shaderProgramID, const StringView& uniformBlockName)
 {
 	tb_error_if(0 == mUniformBuffer, "UniformBuffer has not been properly created, or was somehow lost.");
-	tb_error_if(mWriteIndex >= mBufferData.size(), "The UniformBuffer is filled and cannot accept more data.");
-	if (mWriteIndex < mBufferData.size())
+	tb_error_if(true == mIsBound, "UniformBuffer was bound twice without an Unbind() in between.");
+	tb_error_if(true == mIsMapped, "UniformBuffer region must be unmapped before Bind().");
+
+	GetUniformBlockIndex(shaderProgramID, uniformBlockName);
+
+	const GLintptr regionOffset = mRegionStride * static_cast<GLintptr>(mActiveRegion);
+	tb_check_gl_errors(glBindBufferRange(GL_UNIFORM_BUFFER, 0, mUniformBuffer, regionOffset, mRegionBytes));
+	mIsBound = true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::ShaderSystem::Implementation::UniformRingBuffer::Unbind(void)
+{
+	tb_check_gl_errors(glBindBufferBase(GL_UNIFORM_BUFFER, 0, 0));
+
+	if (true == mIsBound)
+	{	//Fence the region the draws were just issued with, a later fence on the same region covers the earlier draws.
+		GLsync& fence = mFences[mActiveRegion];
+		if (nullptr != fence)
+		{
+			tb_check_gl_errors(glDeleteSync(fence));
+		}
+
+		tb_check_gl_errors(fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+		mIsBound = false;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::ShaderSystem::Implementation::DirtyRange Asteroids::ShaderSystem::Implementation::CopyChangedRows(
+	tbCore::uint8* previous, const tbCore::uint8* current, const size_t byteCount)
+{
+	tb_error_if(0 != byteCount % kUniformRowBytes, "UniformBlock size must be a multiple of %d bytes.", static_cast<int>(kUniformRowBytes));
+
+	DirtyRange changedRange;
+	for (size_t rowOffset = 0; rowOffset < byteCount; rowOffset += kUniformRowBytes)
 	{
-		//The UniformBuffer was originally made to support the Animation system with transforms into the shader. This
-		//code certainly should not be here, but allowed quick testing walking back up the chain to apply parent transforms.
-		//It was simply a convenient place. Read up in the ice_animation.py script from the exporter, at least on the
-		//testing-animation-support branch created 2021-12-25.
-		//
-		// 2022-04-14: I don't know what comment I was supposed to read in the ice_animation.py script... There was nothing
-		//   related to this in there. Guess I'll be left hanging, and hopefully not leave future selves hanging too!
-		//
-		// 2024-01-11: When I started reinvestigating animation support, the PushData() contents just set the data to
-		//   the writeIndex and incremented write index. There were no hacks for walking up the chain. I believe the top
-		//   part of this comment (which was marked unknown in 2022-04-14 comment) is referring to the struggle of making
-		//   the decision to export the data as boneToRoot or boneToParent. 99% sure that we were testing boneToParent
-		//   when the hack code was in use. If we wind up using boneToRoot in the export than buffer[write] = data is
-		//   all that is necessary, and as the hack says, all of this code should be outside the UniformBuffer anyway.
-		//{	//HACKS
-		//	tbMath::Matrix4 toRoot = tbMath::Matrix4::Identity();
-		//	for (size_t index = 0; index < mWriteIndex; ++index)
-		//	{
-		//		//toRoot *= mBufferData[index];
-		//		toRoot = mBufferData[index] * toRoot;
-		//	}
+		if (0 != memcmp(previous + rowOffset, current + rowOffset, kUniformRowBytes))
+		{
+			memcpy(previous + rowOffset, current + rowOffset, kUniformRowBytes);
+			MergeDirtyRange(changedRange, DirtyRange{ rowOffset, rowOffset + kUniformRowBytes });
+		}
+	}
 
-		//	mBufferData[mWriteIndex] = data * toRoot;
-		//}
+	return changedRange;
+}
 
-		////const tbMath::Matrix4 parentToRoot = (true == mBufferData.empty()) ? tbMath::Matrix4::Identity() : mBufferData.back();
-		////mBufferData[mWriteIndex] = data * parentToRoot;
+//--------------------------------------------------------------------------------------------------------------------//
 
-		mBufferData[mWriteIndex] = data;
-		++mWriteIndex;
+void Asteroids::ShaderSystem::Implementation::MergeDirtyRange(DirtyRange& dirtyRange, const DirtyRange& changedRange)
+{
+	if (changedRange.mBegin == changedRange.mEnd)
+	{
+		return;
 	}
 
-	return (mWriteIndex < mBufferData.size());
+	if (dirtyRange.mBegin == dirtyRange.mEnd)
+	{
+		dirtyRange = changedRange;
+	}
+	else
+	{
+		dirtyRange.mBegin = std::min(dirtyRange.mBegin, changedRange.mBegin);
+		dirtyRange.mEnd = std::max(dirtyRange.mEnd, changedRange.mEnd);
+	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::ShaderSystem::UniformBuffer::Bind(ShaderHandle& shader, const String& uniformBlockName)
+void Asteroids::ShaderSystem::Implementation::RegisterUniformBlockLayout(const StringView& blockName, const size_t blockSize,
+	const Std140::Member* members, const size_t memberCount)
 {
-	tbCore::uint32 shaderProgramID = ShaderSystem::Implementation::ShaderHandleToProgramID(shader);
+	std::vector<UniformBlockLayout>& allLayouts = GetAllUniformBlockLayouts();
+	for (const UniformBlockLayout& layout : allLayouts)
+	{
+		if (layout.mBlockName == blockName)
+		{
+			tb_error_if(layout.mBlockSize != blockSize, "UniformBlock \"%s\" was registered with two different sizes.", layout.mBlockName.c_str());
+			return;
+		}
+	}
 
-	GLuint bufferIndex = 0;
-	tb_check_gl_errors(bufferIndex = glGetUniformBlockIndex(shaderProgramID, uniformBlockName.c_str()));
-	tb_check_gl_errors(glUniformBlockBinding(shaderProgramID, bufferIndex, 0));
-	tb_check_gl_errors(glBindBufferBase(GL_UNIFORM_BUFFER, 0, mUniformBuffer));
+	allLayouts.push_back(UniformBlockLayout{ String(blockName), blockSize, std::vector<Std140::Member>(members, members + memberCount) });
+}
 
-	//tb_check_gl_errors(glBufferData(GL_UNIFORM_BUFFER, kElementSize * mWriteIndex, mBufferData.data(), GL_DYNAMIC_DRAW));
+//--------------------------------------------------------------------------------------------------------------------//
 
-	Type* bufferData = nullptr;
-	tb_check_gl_errors(bufferData = reinterpret_cast<Type*>(
-		glMapBufferRange(GL_UNIFORM_BUFFER, 0, kElementSize * kBatchSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT)));
-	memcpy(bufferData, mBufferData.data(), kElementSize * mWriteIndex);
+bool Asteroids::ShaderSystem::Implementation::VerifyUniformBlockLayouts(const tbCore::uint32 shaderProgramID)
+{
+	bool allLayoutsMatch = true;
+	for (const UniformBlockLayout& layout : GetAllUniformBlockLayouts())
+	{
+		allLayoutsMatch &= VerifyUniformBlockLayout(shaderProgramID, layout.mBlockName);
+	}
 
-	rand();
-	tb_check_gl_errors(glUnmapBuffer(GL_UNIFORM_BUFFER));
+	return allLayoutsMatch;
+}
 
+//--------------------------------------------------------------------------------------------------------------------//
 
+bool Asteroids::ShaderSystem::Implementation::VerifyUniformBlockLayout(const tbCore::uint32 shaderProgramID,
+	const String& uniformBlockName)
+{
+	const std::vector<UniformBlockLayout>& allLayouts = GetAllUniformBlockLayouts();
+	const auto layoutIterator = std::find_if(allLayouts.begin(), allLayouts.end(),
+		[&uniformBlockName](const UniformBlockLayout& layout) { return layout.mBlockName == uniformBlockName; });
+	if (layoutIterator == allLayouts.end())
+	{
+		return true;
+	}
 
-	//tbMath::Matrix4* bufferData = nullptr;
-	//tb_check_gl_errors(bufferData = reinterpret_cast<tbMath::Matrix4*>(
-	//	glMapBufferRange(GL_UNIFORM_BUFFER, 0, kElementSize * kBatchSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT)));
+	GLuint blockIndex = GL_INVALID_INDEX;
+	tb_check_gl_errors(blockIndex = glGetUniformBlockIndex(shaderProgramID, uniformBlockName.c_str()));
+	if (GL_INVALID_INDEX == blockIndex)
+	{	//This program does not use the block at all.
+		return true;
+	}
 
+	bool layoutMatches = true;
 
-	//If we want to support filling a buffer up, for instanced rendering with multiple batches we need to unmap the
-	//buffer range once it is filled, then do the render call, and map the range again.  Basically loop over all the
-	//elements and if currentIndex > batchSize do the following before continuing to iterate.
-	//
-	//     tb_check_gl_errors(glUnmapBuffer(GL_UNIFORM_BUFFER));
-	//     theMeshManager.RenderInstancedMesh(itr->first, particleInstanceIndex);
-	//
-	//     tb_check_gl_errors(bufferData = reinterpret_cast<tbMath::Matrix4*>(
-	//         glMapBufferRange(GL_UNIFORM_BUFFER, 0, kElementSize * kBatchSize,
-	//         GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT)));
-	//
-	//Before continuing to add instanced data like we did in particle/billboards.
-	//     bufferData[instanceIndex] = actualData;
-	//     ++currentIndex;
-	//
-	//Instead, as of now 2021-12-25 we are just assuming you can't/won't overflow the buffer per single bind call.
+	GLint blockDataSize = 0;
+	tb_check_gl_errors(glGetActiveUniformBlockiv(shaderProgramID, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &blockDataSize));
+	if (static_cast<size_t>(blockDataSize) > layoutIterator->mBlockSize)
+	{
+		tb_always_log(LogShader::Error() << "UniformBlock " << QuotedString(uniformBlockName) << " is " <<
+			layoutIterator->mBlockSize << " bytes in C++ but the shader expects " << blockDataSize << " bytes.");
+		layoutMatches = false;
+	}
+
+	for (const Std140::Member& member : layoutIterator->mMembers)
+	{
+		const String memberName(member.mName);
+		const GLchar* memberNames[] = { memberName.c_str() };
+		GLuint memberIndex = GL_INVALID_INDEX;
+		tb_check_gl_errors(glGetUniformIndices(shaderProgramID, 1, memberNames, &memberIndex));
+		if (GL_INVALID_INDEX == memberIndex)
+		{
+			tb_always_log(LogShader::Error() << "UniformBlock " << QuotedString(uniformBlockName) << " member " <<
+				QuotedString(memberName) << " was not found in the linked program.");
+			layoutMatches = false;
+			continue;
+		}
+
+		GLint memberOffset = -1;
+		tb_check_gl_errors(glGetActiveUniformsiv(shaderProgramID, 1, &memberIndex, GL_UNIFORM_OFFSET, &memberOffset));
+		if (static_cast<size_t>(memberOffset) != member.mOffset)
+		{
+			tb_always_log(LogShader::Error() << "UniformBlock " << QuotedString(uniformBlockName) << " member " <<
+				QuotedString(memberName) << " is at offset " << member.mOffset << " in C++ but " << memberOffset <<
+				" in the shader.");
+			layoutMatches = false;
+		}
+	}
 
-	//Now free to render with UniformBuffer attached to the shader.
+	tb_error_if(false == layoutMatches, "UniformBlock \"%s\" layout does not match the shader, see the log for details.",
+		uniformBlockName.c_str());
+	return layoutMatches;
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 
-void Asteroids::ShaderSystem::UniformBuffer::Unbind(void)
+void Asteroids::ShaderSystem::CreateUniformBuffers(void)
 {
-	//tb_check_gl_errors(glUnmapBuffer(GL_UNIFORM_BUFFER));
-	//bufferData = nullptr;
+	Implementation::UniformRingBuffer::OnCreateGraphicsContext();
+}
 
-	tb_check_gl_errors(glBindBufferBase(GL_UNIFORM_BUFFER, 0, 0));
+//--------------------------------------------------------------------------------------------------------------------//
 
-	tb_check_recent_gl_errors("UniformBuffer Bind");
-	tbGraphics::Implementation::Renderer::ClearErrors("Asteroids UniformBuffer Bind");
+void Asteroids::ShaderSystem::DestroyUniformBuffers(void)
+{
+	Implementation::UniformRingBuffer::OnDestroyGraphicsContext();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class UniformBlockDirtyRangeTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		UniformBlockDirtyRangeTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::UniformBlockDirtyRangeTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			using namespace ShaderSystem::Implementation;
+
+			std::array<float, 64> previous{};
+			std::array<float, 64> current{};
+			const size_t byteCount = sizeof(previous);
+			tbCore::uint8* previousBytes = reinterpret_cast<tbCore::uint8*>(previous.data());
+			const tbCore::uint8* currentBytes = reinterpret_cast<const tbCore::uint8*>(current.data());
+
+			DirtyRange changedRange = CopyChangedRows(previousBytes, currentBytes, byteCount);
+			ExpectedValue(changedRange.mBegin == changedRange.mEnd, true, "Expected no change between matching blocks.");
+
+			//A float in the third row and one in the sixth, everything from the third to the sixth row is dirty.
+			current[9] = 0.5f;
+			current[22] = 0.25f;
+			changedRange = CopyChangedRows(previousBytes, currentBytes, byteCount);
+			ExpectedValue(changedRange.mBegin, size_t(32), "Expected the range to start at the first changed row.");
+			ExpectedValue(changedRange.mEnd, size_t(96), "Expected the range to end after the last changed row.");
+			ExpectedValue(previous[9] == 0.5f && previous[22] == 0.25f, true, "Expected the changed rows to be copied.");
+
+			changedRange = CopyChangedRows(previousBytes, currentBytes, byteCount);
+			ExpectedValue(changedRange.mBegin == changedRange.mEnd, true, "Expected nothing to change once copied.");
+
+			DirtyRange dirtyRange;
+			MergeDirtyRange(dirtyRange, DirtyRange{ 32, 48 });
+			MergeDirtyRange(dirtyRange, DirtyRange{ 0, 0 });
+			ExpectedValue(dirtyRange.mBegin == 32 && dirtyRange.mEnd == 48, true, "Expected an empty range to change nothing.");
+			MergeDirtyRange(dirtyRange, DirtyRange{ 128, 144 });
+			ExpectedValue(dirtyRange.mBegin == 32 && dirtyRange.mEnd == 144, true, "Expected the ranges to be joined.");
+
+			return true;
+		}
+	};
+
+	UniformBlockDirtyRangeTest theUniformBlockDirtyRangeTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
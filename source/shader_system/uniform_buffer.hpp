@@ -15,39 +15,273 @@
 #include <turtle_brains/math/tb_matrix.hpp>
 
 #include "../shader_system/shader_manager.hpp"
+#include "../shader_system/std140.hpp"
 
 #include <array>
+#include <cstring>
+#include <map>
 
 namespace Asteroids::ShaderSystem
 {
+	namespace Implementation
+	{
+		//Exists in shader_manager.cpp
+		tbCore::uint32 ShaderHandleToProgramID(const ShaderHandle& shaderHandle);
+
+		///
+		/// @details The GL side of every uniform block; one buffer split into kRegionCount regions. New contents are
+		///   written to the next region after AdvanceRegion() so the CPU never writes into a region the GPU may still
+		///   be reading, and a fence is placed on the active region at each Unbind(). A region can be bound for any
+		///   number of draws until the next advance. When ARB_buffer_storage is available the regions are persistently
+		///   mapped, otherwise the buffer gets orphaned if the GPU is still behind.
+		///
+		class UniformRingBuffer : public tbCore::Noncopyable
+		{
+		public:
+			static const size_t kRegionCount = 3;
+
+			explicit UniformRingBuffer(const size_t regionBytes);
+			~UniformRingBuffer(void);
+
+			void CreateBuffer(void);
+			void DestroyBuffer(void);
+
+			inline bool IsCreated(void) const { return 0 != mUniformBuffer; }
+			inline size_t GetActiveRegion(void) const { return mActiveRegion; }
+			inline size_t GetRegionBytes(void) const { return mRegionBytes; }
+			inline bool AreContentsLost(void) const { return mContentsLost; }
+
+			///
+			/// @details Moves on to the next region, which is where the next AcquireActiveRegion() and Bind() land.
+			///
+			void AdvanceRegion(void);
+
+			///
+			/// @details Waits for, or orphans, the active region so it can be written. Returns true when the contents
+			///   of every region were lost; either the buffer was just created or had to be orphaned.
+			///
+			bool AcquireActiveRegion(void);
+
+			///
+			/// @details Returns writable memory for the given range of the active region which remains valid until
+			///   UnmapActiveRegion(). AcquireActiveRegion() must be called first.
+			///
+			tbCore::uint8* MapActiveRegion(const size_t byteOffset, const size_t byteCount);
+			void UnmapActiveRegion(void);
+
+			///
+			/// @details The block name must outlive the buffer, it is kept as the key of the block index cache; the
+			///   kBlockName literal of a Std140::BlockLayout is what this expects.
+			///
+			void Bind(const tbCore::uint32 shaderProgramID, const StringView& uniformBlockName);
+			void Unbind(void);
+
+			static void OnCreateGraphicsContext(void);
+			static void OnDestroyGraphicsContext(void);
+
+			///
+			/// @details Forgets the block indices every buffer cached for the program, to be called when the program is
+			///   deleted since the driver may give its name to the next program linked, like a hot reloaded shader.
+			///
+			static void InvalidateProgram(const tbCore::uint32 shaderProgramID);
+
+			///
+			/// @details The bytes mapped for writing by every uniform block since the last ResetBytesUploaded().
+			///
+			static size_t GetBytesUploaded(void);
+			static void ResetBytesUploaded(void);
+
+		private:
+			// 2026-10-19: glGetUniformBlockIndex() was called on every Bind(), the index for a program and block name
+			//   never changes after linking so it gets cached here, until InvalidateProgram() as the program is deleted.
+			GLuint GetUniformBlockIndex(const tbCore::uint32 shaderProgramID, const StringView& uniformBlockName);
+
+			const size_t mRegionBytes;
+			GLuint mUniformBuffer;
+			GLsizeiptr mRegionStride;
+			tbCore::uint8* mPersistentData;
+			std::array<GLsync, kRegionCount> mFences;
+			size_t mActiveRegion;
+			bool mIsMapped;
+			bool mIsBound;
+			bool mContentsLost;
+			std::map<std::pair<tbCore::uint32, StringView>, GLuint> mBlockIndices;
+		};
+
+		///
+		/// @details A range of bytes within a uniform block, empty when mBegin == mEnd.
+		///
+		struct DirtyRange
+		{
+			size_t mBegin = 0;
+			size_t mEnd = 0;
+		};
+
+		///
+		/// @details Compares the blocks one 16 byte row at a time, copying the rows of current that differ into
+		///   previous, and returns the range from the first to the last row that changed.
+		///
+		DirtyRange CopyChangedRows(tbCore::uint8* previous, const tbCore::uint8* current, const size_t byteCount);
+
+		///
+		/// @details Grows dirtyRange to also cover changedRange, doing nothing when changedRange is empty.
+		///
+		void MergeDirtyRange(DirtyRange& dirtyRange, const DirtyRange& changedRange);
+
+		///
+		/// @details Remembers the layout of a Std140 block so that it can be checked against each program that uses it
+		///   once the program has been linked.
+		///
+		void RegisterUniformBlockLayout(const StringView& blockName, const size_t blockSize,
+			const Std140::Member* members, const size_t memberCount);
+
+		///
+		/// @details Checks every registered block that is active in the program against the reflection of the linked
+		///   program, returning false and triggering an error if any member offset or the block size is mismatched.
+		///
+		bool VerifyUniformBlockLayouts(const tbCore::uint32 shaderProgramID);
+		bool VerifyUniformBlockLayout(const tbCore::uint32 shaderProgramID, const String& uniformBlockName);
+
+	};	//namespace Implementation
+
+	///
+	/// @details Creates or destroys the GL buffers of every uniform block, for when the graphics context comes and goes.
+	///
+	void CreateUniformBuffers(void);
+	void DestroyUniformBuffers(void);
+
+	///
+	/// @details A uniform buffer whose layout is described by BlockType, a struct built from the Std140 types with a
+	///   matching Std140::BlockLayout<BlockType> specialization. The layout is checked at compile time and again
+	///   against the program reflection, and the GPU memory is sized to the block rather than a fixed 8KB.
+	///
+	///   Fields are written into a copy of the block between BeginWrite() and EndWrite(), which still holds the values
+	///   of the previous write, so only the fields that change need to be set. Each region remembers the rows that
+	///   changed since it was last written and Bind() uploads just those, once per write; binding again for another
+	///   draw reuses the same region.
+	///
 	// 2025-10-21: This came from InternalCombustion::Unstable::UniformBuffer which was originally an implementation
 	//   detail to support skinned animations. We are using it in Asteroids for the fog of wilderness effect, and
 	//   going to try the template thing...
-	//template<typename Type, size_t Size> class UniformBuffer : public tbCore::Noncopyable
-	class UniformBuffer : public tbCore::Noncopyable
+	//
+	// 2026-10-19: The template thing is this UniformBlock. The float UniformBuffer it replaced had no users left so
+	//   is gone, along with the PushData() history that only mattered to the animation system.
+	template<typename BlockType> class UniformBlock : public tbCore::Noncopyable
 	{
 	public:
-		using Type = float;
-		static const size_t Size = 2048;
+		static_assert(std::is_standard_layout_v<BlockType>, "UniformBlock types must be standard layout.");
+		static_assert(std::is_trivially_copyable_v<BlockType>, "UniformBlock types must be trivially copyable.");
+		static_assert(0 == sizeof(BlockType) % 16, "UniformBlock types must be padded to a multiple of 16 bytes.");
+		static_assert(Std140::IsValidLayout<BlockType>(), "UniformBlock type does not follow the std140 layout rules.");
+
+		static const size_t kRegionCount = Implementation::UniformRingBuffer::kRegionCount;
+
+		explicit UniformBlock(void) :
+			tbCore::Noncopyable(),
+			mRingBuffer(sizeof(BlockType)),
+			mBlockData(),
+			mWriteData(),
+			mDirtyRanges(),
+			mBytesUploaded(0),
+			mIsWriting(false),
+			mHasPendingUpload(true)
+		{
+			mDirtyRanges.fill(Implementation::DirtyRange{ 0, sizeof(BlockType) });
+
+			const auto& members = Std140::BlockLayout<BlockType>::kMembers;
+			Implementation::RegisterUniformBlockLayout(Std140::BlockLayout<BlockType>::kBlockName, sizeof(BlockType),
+				members.data(), members.size());
+		}
+
+		~UniformBlock(void)
+		{
+			tb_error_if(true == mIsWriting, "UniformBlock was destroyed during BeginWrite()/EndWrite().");
+		}
+
+		BlockType& BeginWrite(void)
+		{
+			tb_error_if(true == mIsWriting, "UniformBlock::BeginWrite() was called twice without EndWrite().");
+			mIsWriting = true;
+			return mWriteData;
+		}
 
-		explicit UniformBuffer(void);
-		~UniformBuffer(void);
+		void EndWrite(void)
+		{
+			tb_error_if(false == mIsWriting, "UniformBlock::EndWrite() was called without BeginWrite().");
+			mIsWriting = false;
 
-		void Clear(void);
-		bool PushData(const Type& data);
-		void Bind(ShaderHandle& shader, const String& uniformBlockName);
-		void Unbind(void);
+			const Implementation::DirtyRange changedRange = Implementation::CopyChangedRows(
+				reinterpret_cast<tbCore::uint8*>(&mBlockData), reinterpret_cast<const tbCore::uint8*>(&mWriteData), sizeof(BlockType));
+			if (changedRange.mBegin < changedRange.mEnd)
+			{
+				for (Implementation::DirtyRange& dirtyRange : mDirtyRanges)
+				{
+					Implementation::MergeDirtyRange(dirtyRange, changedRange);
+				}
 
-		static void OnCreateGraphicsContext(void);
-		static void OnDestroyGraphicsContext(void);
+				mHasPendingUpload = true;
+			}
+		}
+
+		void Write(const BlockType& blockData)
+		{
+			BeginWrite() = blockData;
+			EndWrite();
+		}
+
+		void Bind(const ShaderHandle& shader)
+		{
+			tb_error_if(true == mIsWriting, "UniformBlock must call EndWrite() before Bind().");
+
+			mBytesUploaded = 0;
+			if (true == mHasPendingUpload || true == mRingBuffer.AreContentsLost())
+			{
+				Upload();
+			}
+
+			mRingBuffer.Bind(Implementation::ShaderHandleToProgramID(shader), Std140::BlockLayout<BlockType>::kBlockName);
+		}
+
+		void Unbind(void)
+		{
+			mRingBuffer.Unbind();
+		}
+
+		///
+		/// @details Returns the number of bytes that were written to the GPU during the most recent Bind(), which is
+		///   only the rows that changed since the region was last written, or nothing when the region was reused.
+		///
+		inline size_t GetBytesUploaded(void) const { return mBytesUploaded; }
 
 	private:
-		const size_t kBatchSize;
-		const size_t kElementSize;
-		GLuint mUniformBuffer;
+		void Upload(void)
+		{
+			mRingBuffer.AdvanceRegion();
+			if (true == mRingBuffer.AcquireActiveRegion())
+			{	//Every region holds garbage, so each needs the whole block.
+				mDirtyRanges.fill(Implementation::DirtyRange{ 0, sizeof(BlockType) });
+			}
+
+			Implementation::DirtyRange& dirtyRange = mDirtyRanges[mRingBuffer.GetActiveRegion()];
+			if (dirtyRange.mBegin < dirtyRange.mEnd)
+			{
+				mBytesUploaded = dirtyRange.mEnd - dirtyRange.mBegin;
+				tbCore::uint8* regionData = mRingBuffer.MapActiveRegion(dirtyRange.mBegin, mBytesUploaded);
+				memcpy(regionData, reinterpret_cast<const tbCore::uint8*>(&mBlockData) + dirtyRange.mBegin, mBytesUploaded);
+				mRingBuffer.UnmapActiveRegion();
+			}
+
+			dirtyRange = Implementation::DirtyRange();
+			mHasPendingUpload = false;
+		}
 
-		std::array<Type, Size> mBufferData;
-		size_t mWriteIndex;
+		Implementation::UniformRingBuffer mRingBuffer;
+		BlockType mBlockData;  //As last written, what every region will hold once its dirty range is uploaded.
+		BlockType mWriteData;
+		std::array<Implementation::DirtyRange, kRegionCount> mDirtyRanges;
+		size_t mBytesUploaded;
+		bool mIsWriting;
+		bool mHasPendingUpload;
 	};
 
 };	//namespace Asteroids::ShaderSystem
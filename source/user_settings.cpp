@@ -31,6 +31,13 @@ void Asteroids::UserSettings::CreateDefaultSettings(void)
 	SetFloat(Settings::MusicVolume(), 0.7f);
 	SetFloat(Settings::SoundVolume(), 0.75f);
 	SetFloat(Settings::ShakeIntensity(), 1.0f);
+	SetInteger(Settings::FogQuality(), 0);
+	SetFloat(Settings::FogResolutionScale(), 0.5f);
+	SetBoolean(Settings::DynamicResolution(), true);
+	SetFloat(Settings::DynamicResolutionMinimum(), 0.5f);
+	SetFloat(Settings::DynamicResolutionMaximum(), 1.0f);
+	SetInteger(Settings::TargetFrameRate(), 60);
+	SetInteger(Settings::ParticleQuality(), 2);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
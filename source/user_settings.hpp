@@ -32,6 +32,15 @@ namespace Asteroids
 		inline String MusicVolume(void) { return "music_volume"; } //Float
 		inline String SoundVolume(void) { return "sound_volume"; } //Float
 		inline String ShakeIntensity(void) { return "shake_intensity"; } //Float
+
+		inline String FogQuality(void) { return "fog_quality"; } //Integer, see ShaderSystem::FogQuality
+		inline String FogResolutionScale(void) { return "fog_resolution_scale"; } //Float, 0.25 to 1.0
+		inline String ParticleQuality(void) { return "particle_quality"; } //Integer, see ParticleQuality
+
+		inline String DynamicResolution(void) { return "dynamic_resolution"; } //Boolean
+		inline String DynamicResolutionMinimum(void) { return "dynamic_resolution_minimum"; } //Float, 0.1 to 1.0
+		inline String DynamicResolutionMaximum(void) { return "dynamic_resolution_maximum"; } //Float, 0.1 to 1.0
+		inline String TargetFrameRate(void) { return "target_frame_rate"; } //Integer
 	};
 
 	///
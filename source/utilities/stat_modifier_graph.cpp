@@ -0,0 +1,242 @@
+///
+/// @file
+/// @details Folds the modifiers of every purchased upgrade level into a flat add and multiplier per stat, so the
+///   effective value of a stat is read from an array rather than summed over all the upgrades each time.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../utilities/stat_modifier_graph.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+	const size_t kNeverRead = static_cast<size_t>(-1);
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::StatModifierGraph::StatModifierGraph(void) :
+	mBaseStats(),
+	mStatAdds(),
+	mStatMultipliers(),
+	mEffectiveStats(),
+	mBaseStatRevisions(),
+	mDirtyStats()
+{
+	mBaseStats.fill(0.0);
+	mEffectiveStats.fill(0.0);
+	mBaseStatRevisions.fill(kNeverRead);
+	ClearUpgrades();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+Asteroids::StatModifierGraph::~StatModifierGraph(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::StatModifierGraph::ClearUpgrades(void)
+{
+	mStatAdds.fill(0.0);
+	mStatMultipliers.fill(1.0);
+	mDirtyStats.set();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::StatModifierGraph::AddUpgradeLevels(const UpgradeData& upgrade, const int levels)
+{
+	tb_error_if(levels < 0, "Expected purchased levels to be added, not removed; use ClearUpgrades() and add them again.");
+
+	for (const StatValuePair& statAdd : upgrade.mStatModifyAdds)
+	{
+		if (Stat::Unknown != statAdd.first)
+		{
+			mStatAdds[static_cast<size_t>(statAdd.first)] += statAdd.second * levels;
+			mDirtyStats.set(static_cast<size_t>(statAdd.first));
+		}
+	}
+
+	for (const StatValuePair& statMultiplier : upgrade.mStatModifyMults)
+	{
+		if (Stat::Unknown != statMultiplier.first)
+		{
+			mStatMultipliers[static_cast<size_t>(statMultiplier.first)] *= (1 == levels) ?
+				statMultiplier.second : std::pow(statMultiplier.second, static_cast<StatType>(levels));
+			mDirtyStats.set(static_cast<size_t>(statMultiplier.first));
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::StatModifierGraph::SetBaseStat(const Stat& statIndex, const StatType& value)
+{
+	const size_t statSlot = static_cast<size_t>(statIndex);
+	if (value != mBaseStats[statSlot])
+	{
+		mBaseStats[statSlot] = value;
+		mDirtyStats.set(statSlot);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::StatModifierGraph::Update(void)
+{
+	for (size_t statSlot = 0; statSlot < kNumberOfStats; ++statSlot)
+	{
+		const Stat statIndex = static_cast<Stat>(statSlot);
+		const size_t statRevision = GameManager::GetStatRevision(statIndex);
+		if (statRevision != mBaseStatRevisions[statSlot])
+		{
+			mBaseStatRevisions[statSlot] = statRevision;
+			SetBaseStat(statIndex, GetStat(statIndex));
+		}
+	}
+
+	UpdateDirtyStats();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void Asteroids::StatModifierGraph::UpdateDirtyStats(void)
+{
+	if (false == mDirtyStats.any())
+	{
+		return;
+	}
+
+	for (size_t statSlot = 0; statSlot < kNumberOfStats; ++statSlot)
+	{
+		if (true == mDirtyStats.test(statSlot))
+		{
+			mEffectiveStats[statSlot] = (mBaseStats[statSlot] + mStatAdds[statSlot]) * mStatMultipliers[statSlot];
+		}
+	}
+
+	mDirtyStats.reset();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace Asteroids::UnitTesting
+{
+
+	class StatModifierGraphTest : public tbCore::UnitTest::TestCaseInterface
+	{
+	public:
+		StatModifierGraphTest(void) :
+			tbCore::UnitTest::TestCaseInterface("Asteroids::StatModifierGraphTest")
+		{
+		}
+
+	protected:
+		virtual bool OnRunTest(void) override
+		{
+			const auto isNear = [](const StatType value, const StatType expected) {
+				return std::fabs(value - expected) <= 0.000001 * tbMath::Maximum(1.0, std::fabs(expected));
+			};
+
+			UpgradeData experienceBoost;
+			experienceBoost.mStatModifyAdds = { { Stat::Experience, 5.0 } };
+			experienceBoost.mStatModifyMults = { { Stat::Experience, 1.5 } };
+
+			UpgradeData levelBoost;
+			levelBoost.mStatModifyAdds = { { Stat::Level, 1.0 }, { Stat::Unknown, 100.0 } };
+
+			{	//Adds stack by sum, multipliers by product, and only stats that were touched change.
+				StatModifierGraph graph;
+				graph.SetBaseStat(Stat::Experience, 10.0);
+				graph.SetBaseStat(Stat::Level, 2.0);
+				graph.AddUpgradeLevels(experienceBoost, 2);
+				graph.AddUpgradeLevels(levelBoost);
+				ExpectedValue(graph.IsDirty(), true, "Expected purchased levels to leave the graph dirty.");
+
+				graph.UpdateDirtyStats();
+				ExpectedValue(graph.IsDirty(), false, "Expected nothing dirty after updating.");
+				ExpectedValue(isNear(graph.GetEffectiveStat(Stat::Experience), (10.0 + 10.0) * 2.25), true,
+					"Expected (base + adds) * multipliers for the experience.");
+				ExpectedValue(isNear(graph.GetEffectiveStat(Stat::Level), 3.0), true, "Expected the level to be added to.");
+				ExpectedValue(isNear(graph.GetEffectiveStat(Stat::TotalPlayTime), 0.0), true, "Expected untouched stats unchanged.");
+
+				graph.SetBaseStat(Stat::Level, 2.0);
+				ExpectedValue(graph.IsDirty(), false, "Expected setting the same base value to dirty nothing.");
+				graph.SetBaseStat(Stat::Level, 4.0);
+				graph.UpdateDirtyStats();
+				ExpectedValue(isNear(graph.GetEffectiveStat(Stat::Level), 5.0), true, "Expected a base change to carry through.");
+
+				graph.ClearUpgrades();
+				graph.UpdateDirtyStats();
+				ExpectedValue(isNear(graph.GetEffectiveStat(Stat::Experience), 10.0), true, "Expected cleared upgrades to leave the base.");
+			}
+
+			{	//Benchmark 10k purchased levels against folding over every level on each read.
+				const int kUpgradeLevels = 10000;
+				const int kReads = 1000;
+
+				UpgradeData smallBoost;
+				smallBoost.mStatModifyAdds = { { Stat::Experience, 0.25 }, { Stat::Level, 0.001 } };
+				smallBoost.mStatModifyMults = { { Stat::Experience, 1.0001 } };
+				const std::vector<const UpgradeData*> purchasedLevels(kUpgradeLevels, &smallBoost);
+
+				StatModifierGraph graph;
+				graph.SetBaseStat(Stat::Experience, 100.0);
+
+				const auto buildStart = std::chrono::steady_clock::now();
+				for (const UpgradeData* upgrade : purchasedLevels)
+				{
+					graph.AddUpgradeLevels(*upgrade);
+				}
+				graph.UpdateDirtyStats();
+				const std::chrono::duration<double, std::milli> buildTime = std::chrono::steady_clock::now() - buildStart;
+
+				StatType graphTotal = 0.0;
+				const auto graphStart = std::chrono::steady_clock::now();
+				for (int read = 0; read < kReads; ++read)
+				{
+					graphTotal += graph.GetEffectiveStat(Stat::Experience);
+				}
+				const std::chrono::duration<double, std::milli> graphTime = std::chrono::steady_clock::now() - graphStart;
+
+				StatType foldTotal = 0.0;
+				const auto foldStart = std::chrono::steady_clock::now();
+				for (int read = 0; read < kReads; ++read)
+				{
+					StatType adds = 0.0;
+					StatType multipliers = 1.0;
+					for (const UpgradeData* upgrade : purchasedLevels)
+					{
+						adds += upgrade->mStatModifyAdds[0].second;
+						multipliers *= upgrade->mStatModifyMults[0].second;
+					}
+
+					foldTotal += (100.0 + adds) * multipliers;
+				}
+				const std::chrono::duration<double, std::milli> foldTime = std::chrono::steady_clock::now() - foldStart;
+
+				ExpectedValue(isNear(graphTotal, foldTotal), true, "Expected the graph to match folding over every level.");
+				ExpectedValue(isNear(graph.GetEffectiveStat(Stat::Level), kUpgradeLevels * 0.001), true,
+					"Expected every purchased level to be added.");
+				tb_always_log(LogGame::Info() << "StatModifierGraph: " << kUpgradeLevels << " levels built in " << buildTime.count() <<
+					"ms, " << kReads << " reads took " << graphTime.count() << "ms against " << foldTime.count() << "ms folding.");
+			}
+
+			return true;
+		}
+	};
+
+	StatModifierGraphTest theStatModifierGraphTest;
+
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,74 @@
+///
+/// @file
+/// @details Folds the modifiers of every purchased upgrade level into a flat add and multiplier per stat, so the
+///   effective value of a stat is read from an array rather than summed over all the upgrades each time.
+///
+/// <!-- Copyright (c) 2025 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef Asteroids_StatModifierGraph_hpp
+#define Asteroids_StatModifierGraph_hpp
+
+#include "../asteroids.hpp"
+#include "../game_manager.hpp"
+#include "../utilities/tech_tree_upgrade.hpp"
+
+#include <array>
+#include <bitset>
+
+namespace Asteroids
+{
+
+	///
+	/// @details The effective value of a stat is (base + adds) * multipliers, where adds is the sum of MODIFY_ADD and
+	///   multipliers the product of MODIFY_MULTIPLIER over every purchased level. Buying levels or changing a base stat
+	///   only marks the stats it touches dirty, and only those are worked out again by the next Update().
+	///
+	class StatModifierGraph
+	{
+	public:
+		StatModifierGraph(void);
+		~StatModifierGraph(void);
+
+		///
+		/// @details Forgets every purchased level, for a profile reset or switching profiles, the base stats remain.
+		///
+		void ClearUpgrades(void);
+
+		///
+		/// @details Folds the modifiers of the upgrade in once per level, a stack of levels is a single multiply.
+		///
+		void AddUpgradeLevels(const UpgradeData& upgrade, const int levels = 1);
+
+		void SetBaseStat(const Stat& statIndex, const StatType& value);
+
+		///
+		/// @details Reads the base stats that changed since the last Update() from the GameManager, by their revision,
+		///   and works out the effective value of each dirty stat.
+		///
+		void Update(void);
+
+		///
+		/// @details Works out the effective value of each dirty stat without looking at the GameManager.
+		///
+		void UpdateDirtyStats(void);
+
+		inline const StatType& GetEffectiveStat(const Stat& statIndex) const { return mEffectiveStats[static_cast<size_t>(statIndex)]; }
+		inline const StatType& GetStatAdds(const Stat& statIndex) const { return mStatAdds[static_cast<size_t>(statIndex)]; }
+		inline const StatType& GetStatMultipliers(const Stat& statIndex) const { return mStatMultipliers[static_cast<size_t>(statIndex)]; }
+		inline bool IsDirty(void) const { return mDirtyStats.any(); }
+
+	private:
+		static constexpr size_t kNumberOfStats = static_cast<size_t>(Stat::NumberOfStats);
+
+		std::array<StatType, kNumberOfStats> mBaseStats;
+		std::array<StatType, kNumberOfStats> mStatAdds;
+		std::array<StatType, kNumberOfStats> mStatMultipliers;
+		std::array<StatType, kNumberOfStats> mEffectiveStats;
+		std::array<size_t, kNumberOfStats> mBaseStatRevisions; //as of the last Update(), see GameManager::GetStatRevision().
+		std::bitset<kNumberOfStats> mDirtyStats;
+	};
+
+};	//namespace Asteroids
+
+#endif /* Asteroids_StatModifierGraph_hpp */
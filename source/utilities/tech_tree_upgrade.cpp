@@ -67,8 +67,7 @@ Asteroids::StatValueContainer Asteroids::StatValuePairsFrom(const DynamicStructu
 		return StatValueContainer();
 	}
 
-	// 2025-10-02: We are returning a pointer/reference to the stat value which is mutable.
-	GameStats& gameStats = GameManager::GetMutableActiveStats();
+	const GameStats& gameStats = GameManager::GetActiveStats();
 
 	StatValueContainer pairs;
 	pairs.reserve(stats.size());